@@ -0,0 +1,317 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <stdlib.h>
+#include <time.h>
+
+#include <boost/atomic.hpp>
+#include <boost/program_options.hpp>
+#include <boost/thread.hpp>
+
+#include <rsc/misc/langutils.h>
+#include <rsc/runtime/TypeStringTools.h>
+
+#include <rsb/Event.h>
+#include <rsb/MetaData.h>
+
+#include "rsb/tools/simplebuffer/ConcurrentReadBuffer.h"
+#include "rsb/tools/simplebuffer/RingBuffer.h"
+#include "rsb/tools/simplebuffer/SerializedPayload.h"
+#include "rsb/tools/simplebuffer/ShardedBuffer.h"
+#include "rsb/tools/simplebuffer/TimeBoundedBuffer.h"
+
+using namespace std;
+using namespace boost::program_options;
+using namespace rsb;
+using namespace rsb::tools::simplebuffer;
+
+// Drives a buffer implementation from several threads with a configurable
+// mix of inserts and lookups of synthetic events and reports the throughput
+// and latency percentiles of both operations. No RSB transport is involved.
+
+string implementation = "ring";
+unsigned int numShards = 1;
+unsigned int numThreads = 1;
+double readFraction = 0.5;
+double rate = 0.0;
+size_t payloadBytes = 1024;
+double durationSec = 2.0;
+boost::uint64_t bufferTimeMuSec = 500000;
+unsigned int sampleEvery = 16;
+
+BufferPtr createSingleBuffer() {
+    if (implementation == "map") {
+        return BufferPtr(new TimeBoundedBuffer(bufferTimeMuSec));
+    } else if (implementation == "ring") {
+        return BufferPtr(new RingBuffer(bufferTimeMuSec));
+    } else if (implementation == "concurrent") {
+        return BufferPtr(new ConcurrentReadBuffer(bufferTimeMuSec));
+    } else {
+        cerr << "Unknown buffer implementation " << implementation << endl;
+        exit(EXIT_FAILURE);
+    }
+}
+
+BufferPtr createBuffer() {
+    if (numShards == 1) {
+        return createSingleBuffer();
+    }
+    vector<BufferPtr> shards;
+    for (unsigned int i = 0; i < numShards; ++i) {
+        shards.push_back(createSingleBuffer());
+    }
+    return BufferPtr(new ShardedBuffer(shards));
+}
+
+boost::uint64_t nanoTime() {
+    timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return boost::uint64_t(time.tv_sec) * 1000000000 + time.tv_nsec;
+}
+
+/**
+ * The events inserted by one worker thread so far, which other workers may
+ * look up.
+ */
+struct Producer: private boost::noncopyable {
+    Producer() :
+            inserted(0) {
+    }
+
+    rsc::misc::UUID participant;
+    boost::atomic<boost::uint32_t> inserted;
+};
+
+typedef boost::shared_ptr<Producer> ProducerPtr;
+
+class Worker {
+public:
+
+    Worker(BufferPtr buffer, vector<ProducerPtr> &producers,
+            const unsigned int &index, SerializedPayloadPtr payload,
+            const boost::atomic<bool> &stop) :
+            buffer(buffer), producers(producers), index(index), payload(
+                    payload), stop(stop), random(index * 7919 + 1), inserts(
+                    0), lookups(0), hits(0) {
+    }
+
+    void operator()() {
+
+        static const string TYPE = rsc::runtime::typeName<SerializedPayload>();
+        Producer &own = *producers[index];
+        const double threadRate = rate / numThreads;
+        const boost::uint64_t start = nanoTime();
+        boost::uint64_t operations = 0;
+
+        while (!stop) {
+
+            if (threadRate > 0.0) {
+                double due = double(nanoTime() - start) / 1e9 * threadRate;
+                if (double(operations) >= due) {
+                    boost::this_thread::yield();
+                    continue;
+                }
+            }
+            ++operations;
+            bool sample = operations % sampleEvery == 0;
+
+            if (nextRandom() % 10000 < readFraction * 10000) {
+                Producer &producer =
+                        *producers[nextRandom() % producers.size()];
+                boost::uint32_t inserted = producer.inserted.load(
+                        boost::memory_order_relaxed);
+                if (inserted == 0) {
+                    continue;
+                }
+                // prefer recent events like clients of the buffer do
+                EventId id(producer.participant,
+                        inserted - 1 - nextRandom() % min(inserted, 65536u));
+                boost::uint64_t before = sample ? nanoTime() : 0;
+                EventPtr event = buffer->get(id);
+                if (sample) {
+                    getLatencies.push_back(nanoTime() - before);
+                }
+                ++lookups;
+                if (event) {
+                    ++hits;
+                }
+            } else {
+                EventPtr event(new Event(Scope("/benchmark"), payload, TYPE));
+                boost::uint32_t sequenceNumber = own.inserted.load(
+                        boost::memory_order_relaxed);
+                event->setId(own.participant, sequenceNumber);
+                event->mutableMetaData().setDeliverTime(
+                        rsc::misc::currentTimeMicros());
+                boost::uint64_t before = sample ? nanoTime() : 0;
+                buffer->insert(event);
+                if (sample) {
+                    insertLatencies.push_back(nanoTime() - before);
+                }
+                own.inserted.store(sequenceNumber + 1,
+                        boost::memory_order_relaxed);
+                ++inserts;
+            }
+
+        }
+
+    }
+
+    BufferPtr buffer;
+    vector<ProducerPtr> &producers;
+    unsigned int index;
+    SerializedPayloadPtr payload;
+    const boost::atomic<bool> &stop;
+    boost::uint32_t random;
+
+    boost::uint64_t inserts;
+    boost::uint64_t lookups;
+    boost::uint64_t hits;
+    vector<boost::uint64_t> insertLatencies;
+    vector<boost::uint64_t> getLatencies;
+
+private:
+
+    boost::uint32_t nextRandom() {
+        random = random * 1103515245 + 12345;
+        return random >> 8;
+    }
+
+};
+
+boost::uint64_t percentile(const vector<boost::uint64_t> &sorted,
+        const double &quantile) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    size_t rank = size_t(quantile * (sorted.size() - 1) + 0.5);
+    return sorted[rank];
+}
+
+void printResult(const string &operation, const boost::uint64_t &count,
+        vector<boost::uint64_t> &latencies, const double &elapsedSec) {
+    sort(latencies.begin(), latencies.end());
+    cout << setw(10) << operation << setw(14) << count << setw(14) << fixed
+            << setprecision(0) << double(count) / elapsedSec << setw(10)
+            << percentile(latencies, 0.5) << setw(10)
+            << percentile(latencies, 0.99) << setw(10)
+            << percentile(latencies, 0.999) << endl;
+}
+
+int main(int argc, char **argv) {
+
+    options_description options("Allowed options");
+    options.add_options()("help,h", "Display a help message.")(
+            "implementation,i", value<string>(&implementation),
+            "The buffer implementation to benchmark: 'ring' (default), 'map' or 'concurrent'.")(
+            "shards,n", value<unsigned int>(&numShards),
+            "Number of shards to distribute events over.")("threads,T",
+            value<unsigned int>(&numThreads),
+            "Number of threads performing operations on the buffer.")(
+            "read-fraction,r", value<double>(&readFraction),
+            "Fraction of operations which are lookups, the rest are inserts.")(
+            "rate,R", value<double>(&rate),
+            "Operations per second of all threads together. 0 runs as fast as possible.")(
+            "payload-size,p", value<size_t>(&payloadBytes),
+            "Bytes of the serialized payload of each event.")("duration,d",
+            value<double>(&durationSec), "Duration of the run in seconds.")(
+            "time,t", value<boost::uint64_t>(&bufferTimeMuSec),
+            "The time to retain elements in the buffer in musec")(
+            "sample-every,s", value<unsigned int>(&sampleEvery),
+            "Measure the latency of every n-th operation of a thread.");
+
+    variables_map map;
+    store(command_line_parser(argc, argv).options(options).run(), map);
+    notify(map);
+    if (map.count("help")) {
+        cout << "usage: buffer_benchmark [OPTIONS]" << endl;
+        cout << options << endl;
+        exit(EXIT_SUCCESS);
+    }
+    if (numThreads == 0 || numShards == 0 || sampleEvery == 0) {
+        cerr << "Threads, shards and sampling interval must be positive."
+                << endl;
+        exit(EXIT_FAILURE);
+    }
+
+    BufferPtr buffer = createBuffer();
+    SerializedPayloadPtr payload(
+            new SerializedPayload("benchmark", string(payloadBytes, 'x')));
+    vector<ProducerPtr> producers;
+    for (unsigned int i = 0; i < numThreads; ++i) {
+        producers.push_back(ProducerPtr(new Producer));
+    }
+    boost::atomic<bool> stop(false);
+
+    vector<boost::shared_ptr<Worker> > workers;
+    boost::thread_group threads;
+    boost::uint64_t start = nanoTime();
+    for (unsigned int i = 0; i < numThreads; ++i) {
+        workers.push_back(
+                boost::shared_ptr<Worker>(
+                        new Worker(buffer, producers, i, payload, stop)));
+        threads.create_thread(boost::ref(*workers.back()));
+    }
+    boost::this_thread::sleep(
+            boost::posix_time::microseconds(
+                    boost::int64_t(durationSec * 1000000)));
+    stop = true;
+    threads.join_all();
+    double elapsedSec = double(nanoTime() - start) / 1e9;
+
+    boost::uint64_t inserts = 0;
+    boost::uint64_t lookups = 0;
+    boost::uint64_t hits = 0;
+    vector<boost::uint64_t> insertLatencies;
+    vector<boost::uint64_t> getLatencies;
+    for (vector<boost::shared_ptr<Worker> >::const_iterator it =
+            workers.begin(); it != workers.end(); ++it) {
+        inserts += (*it)->inserts;
+        lookups += (*it)->lookups;
+        hits += (*it)->hits;
+        insertLatencies.insert(insertLatencies.end(),
+                (*it)->insertLatencies.begin(), (*it)->insertLatencies.end());
+        getLatencies.insert(getLatencies.end(), (*it)->getLatencies.begin(),
+                (*it)->getLatencies.end());
+    }
+
+    cout << setw(10) << "operation" << setw(14) << "count" << setw(14)
+            << "ops/s" << setw(10) << "p50 ns" << setw(10) << "p99 ns"
+            << setw(10) << "p999 ns" << endl;
+    printResult("insert", inserts, insertLatencies, elapsedSec);
+    printResult("get", lookups, getLatencies, elapsedSec);
+    cout << "hit ratio " << setprecision(3)
+            << (lookups ? double(hits) / double(lookups) : 0.0)
+            << ", stored events " << buffer->size() << endl;
+
+    return EXIT_SUCCESS;
+
+}
@@ -0,0 +1,519 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <queue>
+#include <string>
+#include <vector>
+
+#include <stdlib.h>
+#include <time.h>
+
+#include <boost/atomic.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/program_options.hpp>
+#include <boost/thread.hpp>
+
+#include <rsc/misc/UUID.h>
+
+#include <rsb/EventId.h>
+#include <rsb/Factory.h>
+#include <rsb/Informer.h>
+#include <rsb/Listener.h>
+#include <rsb/converter/EventsByScopeMapConverter.h>
+#include <rsb/converter/PredicateConverterList.h>
+#include <rsb/converter/SchemaAndByteArrayConverter.h>
+#include <rsb/converter/TypeNameConverterPredicate.h>
+#include <rsb/converter/VoidConverter.h>
+#include <rsb/patterns/LocalServer.h>
+#include <rsb/patterns/RemoteServer.h>
+
+#include "rsb/tools/simplebuffer/BufferInsertHandler.h"
+#include "rsb/tools/simplebuffer/BufferRequestCallback.h"
+#include "rsb/tools/simplebuffer/RingBuffer.h"
+
+using namespace std;
+using namespace boost::program_options;
+using namespace rsb;
+using namespace rsb::converter;
+using namespace rsb::patterns;
+using namespace rsb::tools::simplebuffer;
+
+// Publishes events to several scopes at a target rate and requests them
+// again from a buffer via its get method after a configurable delay.
+// Reports the achieved rates, the ratio of requests answered with the event
+// and the latency percentiles of the RPCs. Latencies are measured from the
+// time a request became due instead of the time it was issued, so that
+// requests delayed by busy requesters are not left out of the percentiles.
+// By default, the buffer is hosted
+// in this process and all participants use the inprocess transport so that
+// no external daemons are required.
+
+string scopeName = "/loadgen";
+string bufferScopeName = "/buffer";
+bool external = false;
+unsigned int numScopes = 4;
+double publishRate = 1000.0;
+size_t payloadBytes = 1024;
+double requestFraction = 1.0;
+double unknownFraction = 0.0;
+string delayDistribution = "fixed";
+double meanDelayMs = 100.0;
+unsigned int numRequesters = 4;
+unsigned int replyTimeoutSec = 5;
+double durationSec = 10.0;
+boost::uint64_t bufferTimeMuSec = 1000000;
+
+boost::uint64_t nanoTime() {
+    timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return boost::uint64_t(time.tv_sec) * 1000000000 + time.tv_nsec;
+}
+
+/**
+ * A configuration which only uses the inprocess transport, or the default
+ * configuration when generating load for an external buffer.
+ */
+ParticipantConfig getLoadConfig() {
+    ParticipantConfig config = getFactory().getDefaultParticipantConfig();
+    if (external) {
+        return config;
+    }
+    set<ParticipantConfig::Transport> transports = config.getTransports(true);
+    for (set<ParticipantConfig::Transport>::const_iterator it =
+            transports.begin(); it != transports.end(); ++it) {
+        config.mutableTransport(it->getName()).setEnabled(
+                it->getName() == "inprocess");
+    }
+    return config;
+}
+
+/**
+ * The load configuration with converters passing payloads through
+ * unconverted, like the simplebuffer tool uses for its participants.
+ *
+ * @param withCollections also pass through collections of events as
+ *                        replies of the buffer contain
+ */
+ParticipantConfig getNoConversionConfig(bool withCollections = false) {
+
+    list<pair<ConverterPredicatePtr, Converter<string>::Ptr> > converters;
+    converters.push_back(
+            make_pair(
+                    ConverterPredicatePtr(
+                            new TypeNameConverterPredicate(
+                                    rsc::runtime::typeName<void>())),
+                    Converter<string>::Ptr(new VoidConverter())));
+    converters.push_back(
+            make_pair(ConverterPredicatePtr(new AlwaysApplicable()),
+                    Converter<string>::Ptr(new SchemaAndByteArrayConverter())));
+    ConverterSelectionStrategy<string>::Ptr strategy(
+            new PredicateConverterList<string>(converters.begin(),
+                    converters.end()));
+    if (withCollections) {
+        Converter<string>::Ptr collectionConverter(
+                new EventsByScopeMapConverter(strategy, strategy));
+        converters.push_front(
+                make_pair(
+                        ConverterPredicatePtr(
+                                new TypeNameConverterPredicate(
+                                        collectionConverter->getDataType())),
+                        collectionConverter));
+        strategy.reset(
+                new PredicateConverterList<string>(converters.begin(),
+                        converters.end()));
+    }
+
+    ParticipantConfig config = getLoadConfig();
+    set<ParticipantConfig::Transport> transports = config.getTransports();
+    for (set<ParticipantConfig::Transport>::const_iterator it =
+            transports.begin(); it != transports.end(); ++it) {
+        ParticipantConfig::Transport &transport = config.mutableTransport(
+                it->getName());
+        rsc::runtime::Properties options = transport.getOptions();
+        options["converters"] = strategy;
+        transport.setOptions(options);
+    }
+    return config;
+
+}
+
+/**
+ * Linear congruential generator as in the buffer benchmark, extended by the
+ * supported delay distributions.
+ */
+class Random {
+public:
+
+    explicit Random(const boost::uint32_t &seed) :
+            state(seed) {
+    }
+
+    /**
+     * Returns a uniformly distributed number in [0, 1).
+     */
+    double next() {
+        state = state * 1103515245 + 12345;
+        return double(state >> 8) / double(1 << 24);
+    }
+
+    /**
+     * Returns a delay in ns according to the configured distribution.
+     */
+    boost::uint64_t nextDelay() {
+        double meanNs = meanDelayMs * 1e6;
+        if (delayDistribution == "uniform") {
+            return boost::uint64_t(2.0 * meanNs * next());
+        } else if (delayDistribution == "exponential") {
+            return boost::uint64_t(-meanNs * log(1.0 - next()));
+        } else {
+            return boost::uint64_t(meanNs);
+        }
+    }
+
+private:
+    boost::uint32_t state;
+};
+
+/**
+ * Requests which become due at a point in time, ordered by that time.
+ */
+class RequestQueue: private boost::noncopyable {
+public:
+
+    RequestQueue() :
+            stopped(false) {
+    }
+
+    void push(const boost::uint64_t &due, const EventId &id) {
+        boost::mutex::scoped_lock lock(mutex);
+        requests.push(Request(due, boost::shared_ptr<EventId>(new EventId(id))));
+        condition.notify_one();
+    }
+
+    /**
+     * Blocks until the earliest request is due and returns it or an empty
+     * pointer once stopped.
+     *
+     * @param due output parameter for the time the request became due in ns
+     */
+    boost::shared_ptr<EventId> pop(boost::uint64_t &due) {
+        boost::mutex::scoped_lock lock(mutex);
+        while (!stopped) {
+            if (requests.empty()) {
+                condition.wait(lock);
+                continue;
+            }
+            boost::uint64_t now = nanoTime();
+            if (requests.top().first > now) {
+                condition.timed_wait(lock,
+                        boost::posix_time::microseconds(
+                                boost::int64_t(
+                                        (requests.top().first - now) / 1000)));
+                continue;
+            }
+            boost::shared_ptr<EventId> id = requests.top().second;
+            due = requests.top().first;
+            requests.pop();
+            return id;
+        }
+        return boost::shared_ptr<EventId>();
+    }
+
+    void stop() {
+        boost::mutex::scoped_lock lock(mutex);
+        stopped = true;
+        condition.notify_all();
+    }
+
+    size_t size() {
+        boost::mutex::scoped_lock lock(mutex);
+        return requests.size();
+    }
+
+private:
+
+    typedef pair<boost::uint64_t, boost::shared_ptr<EventId> > Request;
+
+    struct LaterFirst {
+        bool operator()(const Request &a, const Request &b) const {
+            return a.first > b.first;
+        }
+    };
+
+    boost::mutex mutex;
+    boost::condition_variable condition;
+    priority_queue<Request, vector<Request>, LaterFirst> requests;
+    bool stopped;
+
+};
+
+class Publisher {
+public:
+
+    Publisher(RequestQueue &queue, const boost::atomic<bool> &stop) :
+            queue(queue), stop(stop), random(4711), published(0) {
+    }
+
+    void operator()() {
+
+        vector<Informer<string>::Ptr> informers;
+        for (unsigned int i = 0; i < numScopes; ++i) {
+            Scope scope = Scope(scopeName).concat(
+                    Scope("/" + boost::lexical_cast<string>(i)));
+            informers.push_back(
+                    getFactory().createInformer<string>(scope,
+                            getLoadConfig()));
+        }
+        Informer<string>::DataPtr payload(new string(payloadBytes, 'x'));
+        rsc::misc::UUID unknownParticipant;
+
+        const boost::uint64_t start = nanoTime();
+        while (!stop) {
+
+            double due = double(nanoTime() - start) / 1e9 * publishRate;
+            if (double(published) >= due) {
+                boost::this_thread::yield();
+                continue;
+            }
+
+            EventPtr event = informers[published % numScopes]->publish(
+                    payload);
+            ++published;
+
+            if (random.next() < requestFraction) {
+                EventId id = event->getId();
+                if (random.next() < unknownFraction) {
+                    id = EventId(unknownParticipant, id.getSequenceNumber());
+                }
+                queue.push(nanoTime() + random.nextDelay(), id);
+            }
+
+        }
+
+    }
+
+    RequestQueue &queue;
+    const boost::atomic<bool> &stop;
+    Random random;
+
+    boost::uint64_t published;
+
+};
+
+class Requester {
+public:
+
+    Requester(RemoteServerPtr server, RequestQueue &queue) :
+            server(server), queue(queue), requests(0), hits(0), failures(0) {
+    }
+
+    void operator()() {
+        boost::shared_ptr<EventId> id;
+        boost::uint64_t due;
+        while ((id = queue.pop(due))) {
+            issueLags.push_back((nanoTime() - due) / 1000);
+            try {
+                EventPtr reply = server->call("get",
+                        server->prepareRequestEvent(id), replyTimeoutSec);
+                latencies.push_back((nanoTime() - due) / 1000);
+                ++requests;
+                if (reply->getData()) {
+                    ++hits;
+                }
+            } catch (const exception &) {
+                ++failures;
+            }
+        }
+    }
+
+    RemoteServerPtr server;
+    RequestQueue &queue;
+
+    boost::uint64_t requests;
+    boost::uint64_t hits;
+    boost::uint64_t failures;
+    vector<boost::uint64_t> latencies;
+    vector<boost::uint64_t> issueLags;
+
+};
+
+boost::uint64_t percentile(const vector<boost::uint64_t> &sorted,
+        const double &quantile) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    size_t rank = size_t(quantile * (sorted.size() - 1) + 0.5);
+    return sorted[rank];
+}
+
+int main(int argc, char **argv) {
+
+    options_description options("Allowed options");
+    options.add_options()("help,h", "Display a help message.")("scope,s",
+            value<string>(&scopeName),
+            "The scope below which events are published on numbered sub-scopes.")(
+            "bufferscope,b", value<string>(&bufferScopeName),
+            "The scope of the RPC interface of the buffer. Must not be below the publishing scope.")("external,x",
+            "Request events from a running buffer subscribed to the scope instead of hosting one in this process. Uses the default transports instead of the inprocess transport.")(
+            "scopes,n", value<unsigned int>(&numScopes),
+            "Number of scopes to publish events on in turn.")("rate,R",
+            value<double>(&publishRate),
+            "Events to publish per second on all scopes together.")(
+            "payload-size,p", value<size_t>(&payloadBytes),
+            "Bytes of the string payload of each event.")(
+            "request-fraction,f", value<double>(&requestFraction),
+            "Fraction of published events which are requested again.")(
+            "unknown-fraction,u", value<double>(&unknownFraction),
+            "Fraction of requests which are made for IDs that were never published.")(
+            "delay-distribution,D", value<string>(&delayDistribution),
+            "Distribution of the delay between publishing and requesting an event: 'fixed' (default), 'uniform' between 0 and twice the mean or 'exponential'.")(
+            "delay,d", value<double>(&meanDelayMs),
+            "Mean delay between publishing and requesting an event in ms.")(
+            "requesters,T", value<unsigned int>(&numRequesters),
+            "Number of threads issuing get requests concurrently.")(
+            "timeout", value<unsigned int>(&replyTimeoutSec),
+            "Seconds to wait for a reply before a request counts as failed.")(
+            "duration", value<double>(&durationSec),
+            "Duration of publishing in seconds.")("time,t",
+            value<boost::uint64_t>(&bufferTimeMuSec),
+            "The time to retain elements in the hosted buffer in musec.");
+
+    variables_map map;
+    store(command_line_parser(argc, argv).options(options).run(), map);
+    notify(map);
+    if (map.count("help")) {
+        cout << "usage: buffer_load_generator [OPTIONS]" << endl;
+        cout << options << endl;
+        exit(EXIT_SUCCESS);
+    }
+    external = map.count("external") > 0;
+    if (numScopes == 0 || numRequesters == 0) {
+        cerr << "Scopes and requesters must be positive." << endl;
+        exit(EXIT_FAILURE);
+    }
+    if (delayDistribution != "fixed" && delayDistribution != "uniform"
+            && delayDistribution != "exponential") {
+        cerr << "Unknown delay distribution " << delayDistribution << endl;
+        exit(EXIT_FAILURE);
+    }
+
+    // host the buffer like the simplebuffer tool does
+    ListenerPtr bufferListener;
+    LocalServerPtr bufferServer;
+    if (!external) {
+        BufferPtr buffer(new RingBuffer(bufferTimeMuSec));
+        bufferListener = getFactory().createListener(Scope(scopeName),
+                getNoConversionConfig());
+        bufferListener->addHandler(HandlerPtr(new BufferInsertHandler(buffer)),
+                true);
+        bufferServer = getFactory().createLocalServer(Scope(bufferScopeName),
+                getLoadConfig(), getNoConversionConfig(true));
+        bufferServer->registerMethod("get",
+                LocalServer::CallbackPtr(new BufferRequestCallback(buffer)));
+    }
+    RemoteServerPtr server = getFactory().createRemoteServer(
+            Scope(bufferScopeName), getLoadConfig(), getLoadConfig());
+
+    RequestQueue queue;
+    boost::atomic<bool> stop(false);
+
+    vector<boost::shared_ptr<Requester> > requesters;
+    boost::thread_group requesterThreads;
+    for (unsigned int i = 0; i < numRequesters; ++i) {
+        requesters.push_back(
+                boost::shared_ptr<Requester>(new Requester(server, queue)));
+        requesterThreads.create_thread(boost::ref(*requesters.back()));
+    }
+
+    Publisher publisher(queue, stop);
+    boost::uint64_t start = nanoTime();
+    boost::thread publisherThread(boost::ref(publisher));
+    boost::this_thread::sleep(
+            boost::posix_time::microseconds(
+                    boost::int64_t(durationSec * 1000000)));
+    stop = true;
+    publisherThread.join();
+    double elapsedSec = double(nanoTime() - start) / 1e9;
+
+    // let the requests of the last events become due
+    boost::this_thread::sleep(
+            boost::posix_time::microseconds(
+                    boost::int64_t(
+                            meanDelayMs
+                                    * (delayDistribution == "fixed" ? 1000 : 2000))));
+    size_t pending = queue.size();
+    queue.stop();
+    requesterThreads.join_all();
+
+    boost::uint64_t requests = 0;
+    boost::uint64_t hits = 0;
+    boost::uint64_t failures = 0;
+    vector<boost::uint64_t> latencies;
+    vector<boost::uint64_t> issueLags;
+    for (vector<boost::shared_ptr<Requester> >::const_iterator it =
+            requesters.begin(); it != requesters.end(); ++it) {
+        requests += (*it)->requests;
+        hits += (*it)->hits;
+        failures += (*it)->failures;
+        latencies.insert(latencies.end(), (*it)->latencies.begin(),
+                (*it)->latencies.end());
+        issueLags.insert(issueLags.end(), (*it)->issueLags.begin(),
+                (*it)->issueLags.end());
+    }
+    sort(latencies.begin(), latencies.end());
+    sort(issueLags.begin(), issueLags.end());
+
+    cout << fixed << setprecision(0);
+    cout << "published " << publisher.published << " events, "
+            << double(publisher.published) / elapsedSec << " events/s"
+            << endl;
+    cout << "requested " << requests << " events, "
+            << double(requests) / elapsedSec << " requests/s, " << failures
+            << " failed, " << pending << " not issued" << endl;
+    cout << "hit ratio " << setprecision(3)
+            << (requests ? double(hits) / double(requests) : 0.0) << endl;
+    cout << setw(12) << "" << setw(10) << "p50 us" << setw(10) << "p90 us"
+            << setw(10) << "p99 us" << setw(10) << "p999 us" << setw(10)
+            << "max us" << endl;
+    cout << setw(12) << "latency" << setw(10) << percentile(latencies, 0.5)
+            << setw(10) << percentile(latencies, 0.9) << setw(10)
+            << percentile(latencies, 0.99) << setw(10)
+            << percentile(latencies, 0.999) << setw(10)
+            << (latencies.empty() ? 0 : latencies.back()) << endl;
+    cout << setw(12) << "issue lag" << setw(10) << percentile(issueLags, 0.5)
+            << setw(10) << percentile(issueLags, 0.9) << setw(10)
+            << percentile(issueLags, 0.99) << setw(10)
+            << percentile(issueLags, 0.999) << setw(10)
+            << (issueLags.empty() ? 0 : issueLags.back()) << endl;
+
+    return EXIT_SUCCESS;
+
+}
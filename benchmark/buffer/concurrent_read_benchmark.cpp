@@ -0,0 +1,191 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <stdlib.h>
+
+#include <boost/atomic.hpp>
+#include <boost/program_options.hpp>
+#include <boost/thread.hpp>
+
+#include <rsc/misc/langutils.h>
+
+#include <rsb/Event.h>
+#include <rsb/MetaData.h>
+
+#include "rsb/tools/simplebuffer/ConcurrentReadBuffer.h"
+#include "rsb/tools/simplebuffer/RingBuffer.h"
+#include "rsb/tools/simplebuffer/TimeBoundedBuffer.h"
+
+using namespace std;
+using namespace boost::program_options;
+using namespace rsb;
+using namespace rsb::tools::simplebuffer;
+
+// Measures the insert throughput of a buffer once without readers and once
+// with a number of threads continuously looking up recently inserted events.
+
+string implementation = "concurrent";
+unsigned int numReaders = 4;
+double durationSec = 2.0;
+boost::uint64_t bufferTimeMuSec = 500000;
+
+BufferPtr createBuffer() {
+    if (implementation == "map") {
+        return BufferPtr(new TimeBoundedBuffer(bufferTimeMuSec));
+    } else if (implementation == "ring") {
+        return BufferPtr(new RingBuffer(bufferTimeMuSec));
+    } else if (implementation == "concurrent") {
+        return BufferPtr(new ConcurrentReadBuffer(bufferTimeMuSec));
+    } else {
+        cerr << "Unknown buffer implementation " << implementation << endl;
+        exit(EXIT_FAILURE);
+    }
+}
+
+class LookupTask {
+public:
+
+    LookupTask(BufferPtr buffer, const rsc::misc::UUID &participant,
+            const boost::atomic<boost::uint32_t> &latestSequenceNumber,
+            const boost::atomic<bool> &stop) :
+            buffer(buffer), participant(participant), latestSequenceNumber(
+                    latestSequenceNumber), stop(stop), lookups(0), hits(0) {
+    }
+
+    void operator()() {
+        boost::uint32_t offset = 0;
+        while (!stop) {
+            boost::uint32_t latest = latestSequenceNumber.load(
+                    boost::memory_order_relaxed);
+            // request recent events, some of which are expired already
+            offset = (offset * 1103515245 + 12345) % 65536;
+            if (offset <= latest) {
+                if (buffer->get(EventId(participant, latest - offset))) {
+                    ++hits;
+                }
+                ++lookups;
+            }
+        }
+    }
+
+    BufferPtr buffer;
+    rsc::misc::UUID participant;
+    const boost::atomic<boost::uint32_t> &latestSequenceNumber;
+    const boost::atomic<bool> &stop;
+    boost::uint64_t lookups;
+    boost::uint64_t hits;
+
+};
+
+void runPhase(const unsigned int &readers) {
+
+    BufferPtr buffer = createBuffer();
+    rsc::misc::UUID participant;
+    boost::atomic<boost::uint32_t> latestSequenceNumber(0);
+    boost::atomic<bool> stop(false);
+
+    vector<boost::shared_ptr<LookupTask> > tasks;
+    boost::thread_group threads;
+    for (unsigned int i = 0; i < readers; ++i) {
+        tasks.push_back(
+                boost::shared_ptr<LookupTask>(
+                        new LookupTask(buffer, participant,
+                                latestSequenceNumber, stop)));
+        threads.create_thread(boost::ref(*tasks.back()));
+    }
+
+    boost::uint64_t start = rsc::misc::currentTimeMicros();
+    boost::uint64_t end = start + boost::uint64_t(durationSec * 1000000);
+    boost::uint64_t now = start;
+    boost::uint32_t sequenceNumber = 0;
+    while (now < end) {
+        // check the clock only now and then to not measure it
+        for (unsigned int i = 0; i < 256; ++i) {
+            EventPtr event(new Event);
+            event->setId(participant, sequenceNumber);
+            event->mutableMetaData().setDeliverTime(now);
+            buffer->insert(event);
+            ++sequenceNumber;
+        }
+        latestSequenceNumber.store(sequenceNumber - 1,
+                boost::memory_order_relaxed);
+        now = rsc::misc::currentTimeMicros();
+    }
+    double elapsedSec = double(now - start) / 1000000.0;
+
+    stop = true;
+    threads.join_all();
+
+    boost::uint64_t lookups = 0;
+    boost::uint64_t hits = 0;
+    for (vector<boost::shared_ptr<LookupTask> >::const_iterator it =
+            tasks.begin(); it != tasks.end(); ++it) {
+        lookups += (*it)->lookups;
+        hits += (*it)->hits;
+    }
+
+    cout << setw(8) << readers << setw(16) << fixed << setprecision(0)
+            << double(sequenceNumber) / elapsedSec << setw(16)
+            << double(lookups) / elapsedSec << setw(10) << setprecision(3)
+            << (lookups ? double(hits) / double(lookups) : 0.0) << endl;
+
+}
+
+int main(int argc, char **argv) {
+
+    options_description options("Allowed options");
+    options.add_options()("help,h", "Display a help message.")(
+            "implementation,i", value<string>(&implementation),
+            "The buffer implementation to benchmark: 'concurrent' (default), 'ring' or 'map'.")(
+            "readers,r", value<unsigned int>(&numReaders),
+            "Number of concurrently reading threads for the second phase.")(
+            "duration,d", value<double>(&durationSec),
+            "Duration of each phase in seconds.")("time,t",
+            value<boost::uint64_t>(&bufferTimeMuSec),
+            "The time to retain elements in the buffer in musec");
+
+    variables_map map;
+    store(command_line_parser(argc, argv).options(options).run(), map);
+    notify(map);
+    if (map.count("help")) {
+        cout << "usage: concurrent_read_benchmark [OPTIONS]" << endl;
+        cout << options << endl;
+        exit(EXIT_SUCCESS);
+    }
+
+    cout << setw(8) << "readers" << setw(16) << "inserts/s" << setw(16)
+            << "lookups/s" << setw(10) << "hits" << endl;
+    runPhase(0);
+    runPhase(numReaders);
+
+    return EXIT_SUCCESS;
+
+}
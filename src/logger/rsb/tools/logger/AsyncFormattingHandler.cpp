@@ -0,0 +1,181 @@
+/* ============================================================
+ *
+ * This file is part of the RSB project
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "AsyncFormattingHandler.h"
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+#include <boost/bind.hpp>
+
+using namespace std;
+
+using namespace rsb;
+
+namespace rsb {
+namespace tools {
+namespace logger {
+
+namespace {
+
+/**
+ * Formatted events are collected until the buffer reaches this size
+ * before they are written to the output stream.
+ */
+const streamoff WRITE_CHUNK_SIZE = 64 * 1024;
+
+/**
+ * Upper bound for the number of events the writer thread takes from
+ * the queue at once.
+ */
+const size_t MAX_BATCH_SIZE = 256;
+
+void writeBuffer(ostream &stream, ostringstream &buffer) {
+    string chunk = buffer.str();
+    stream.write(chunk.data(), chunk.size());
+    buffer.str("");
+}
+
+}
+
+AsyncFormattingHandler::AsyncFormattingHandler(EventFormatterPtr formatter,
+                                               ostream          &stream,
+                                               size_t            capacity,
+                                               OverflowPolicy    policy):
+    formatter(formatter), stream(stream), capacity(capacity), policy(policy),
+    terminate(false), droppedOldest(0), droppedNewest(0) {
+    if (this->capacity == 0) {
+        throw invalid_argument("The queue capacity has to be positive.");
+    }
+    this->thread.reset(new boost::thread(boost::bind(&AsyncFormattingHandler::run, this)));
+}
+
+AsyncFormattingHandler::~AsyncFormattingHandler() {
+    stop();
+}
+
+void AsyncFormattingHandler::handle(EventPtr event) {
+    boost::mutex::scoped_lock lock(this->queueMutex);
+    while (!this->terminate && this->queue.size() >= this->capacity) {
+        switch (this->policy) {
+        case BLOCK:
+            this->notFull.wait(lock);
+            break;
+        case DROP_OLDEST:
+            this->queue.pop_front();
+            ++this->droppedOldest;
+            break;
+        case DROP_NEWEST:
+            ++this->droppedNewest;
+            return;
+        }
+    }
+    if (this->terminate) {
+        return;
+    }
+    this->queue.push_back(event);
+    this->notEmpty.notify_one();
+}
+
+void AsyncFormattingHandler::stop() {
+    {
+        boost::mutex::scoped_lock lock(this->queueMutex);
+        this->terminate = true;
+        this->notEmpty.notify_all();
+        this->notFull.notify_all();
+    }
+    if (this->thread) {
+        this->thread->join();
+        this->thread.reset();
+    }
+}
+
+boost::uint64_t AsyncFormattingHandler::getDroppedOldest() {
+    boost::mutex::scoped_lock lock(this->queueMutex);
+    return this->droppedOldest;
+}
+
+boost::uint64_t AsyncFormattingHandler::getDroppedNewest() {
+    boost::mutex::scoped_lock lock(this->queueMutex);
+    return this->droppedNewest;
+}
+
+AsyncFormattingHandler::OverflowPolicy AsyncFormattingHandler::policyFromName(const string &name) {
+    if (name == "block") {
+        return BLOCK;
+    } else if (name == "drop-oldest") {
+        return DROP_OLDEST;
+    } else if (name == "drop-newest") {
+        return DROP_NEWEST;
+    }
+    throw invalid_argument("Unknown overflow policy " + name);
+}
+
+set<string> AsyncFormattingHandler::getPolicyNames() {
+    set<string> names;
+    names.insert("block");
+    names.insert("drop-oldest");
+    names.insert("drop-newest");
+    return names;
+}
+
+void AsyncFormattingHandler::run() {
+    // Events taken by the writer thread can no longer be dropped by
+    // the overflow policy. Hence only a small part of the queue is
+    // taken at once.
+    const size_t batchSize = max<size_t>(1, min(MAX_BATCH_SIZE, this->capacity / 8));
+    deque<EventPtr> batch;
+    ostringstream buffer;
+    while (true) {
+        {
+            boost::mutex::scoped_lock lock(this->queueMutex);
+            while (!this->terminate && this->queue.empty()) {
+                this->notEmpty.wait(lock);
+            }
+            if (this->queue.empty()) {
+                break;
+            }
+            while (!this->queue.empty() && batch.size() < batchSize) {
+                batch.push_back(this->queue.front());
+                this->queue.pop_front();
+            }
+            this->notFull.notify_all();
+        }
+
+        for (deque<EventPtr>::const_iterator it = batch.begin();
+             it != batch.end(); ++it) {
+            try {
+                this->formatter->format(buffer, *it);
+            } catch (const std::exception &e) {
+                cerr << "Could not format event: " << e.what() << endl;
+            }
+            if (buffer.tellp() >= WRITE_CHUNK_SIZE) {
+                writeBuffer(this->stream, buffer);
+            }
+        }
+        writeBuffer(this->stream, buffer);
+        this->stream.flush();
+        batch.clear();
+    }
+}
+
+}
+}
+}
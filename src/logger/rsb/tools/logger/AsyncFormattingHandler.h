@@ -0,0 +1,130 @@
+/* ============================================================
+ *
+ * This file is part of the RSB project
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <deque>
+#include <iostream>
+#include <set>
+#include <string>
+
+#include <boost/cstdint.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread.hpp>
+
+#include <rsb/Handler.h>
+
+#include "EventFormatter.h"
+
+namespace rsb {
+namespace tools {
+namespace logger {
+
+/**
+ * This handler decouples formatting and writing events from the
+ * dispatching of events by RSB. Events are only enqueued by @ref
+ * handle. A dedicated writer thread takes batches of at most an
+ * eighth of the queue capacity, but no more than 256 events, formats
+ * them into a buffer and writes the buffer to the output stream in
+ * large chunks.
+ *
+ * The queue is bounded. When it is full, the overflow policy decides
+ * whether the dispatching thread waits for the writer or whether the
+ * oldest queued or the new event is dropped. Events already taken by
+ * the writer thread are not dropped.
+ */
+class AsyncFormattingHandler: public rsb::Handler {
+public:
+    enum OverflowPolicy {
+        BLOCK,
+        DROP_OLDEST,
+        DROP_NEWEST
+    };
+
+    /**
+     * Creates a handler and starts its writer thread.
+     *
+     * @param formatter The formatter used to format events. It is
+     * only called from the writer thread.
+     * @param stream The stream onto which formatted events are
+     * written.
+     * @param capacity The maximum number of queued events. In
+     * addition, the writer thread holds at most an eighth of @a
+     * capacity, but no more than 256 events while formatting them.
+     * @param policy The action to take when an event arrives while
+     * @a capacity events are queued.
+     */
+    AsyncFormattingHandler(EventFormatterPtr formatter,
+                           std::ostream     &stream,
+                           std::size_t       capacity,
+                           OverflowPolicy    policy);
+
+    /**
+     * Stops the writer thread if this has not been done by @ref stop.
+     */
+    ~AsyncFormattingHandler();
+
+    void handle(rsb::EventPtr event);
+
+    /**
+     * Writes all queued events and waits for the writer thread to
+     * terminate. Events arriving afterwards are ignored.
+     */
+    void stop();
+
+    /**
+     * Returns the number of queued events which were dropped to make
+     * room for newer ones.
+     */
+    boost::uint64_t getDroppedOldest();
+
+    /**
+     * Returns the number of events which were dropped because the
+     * queue was full.
+     */
+    boost::uint64_t getDroppedNewest();
+
+    static OverflowPolicy policyFromName(const std::string &name);
+
+    static std::set<std::string> getPolicyNames();
+private:
+    EventFormatterPtr                 formatter;
+    std::ostream                     &stream;
+    std::size_t                       capacity;
+    OverflowPolicy                    policy;
+
+    std::deque<rsb::EventPtr>         queue;
+    boost::mutex                      queueMutex;
+    boost::condition_variable         notEmpty;
+    boost::condition_variable         notFull;
+    bool                              terminate;
+
+    boost::uint64_t                   droppedOldest;
+    boost::uint64_t                   droppedNewest;
+
+    boost::shared_ptr<boost::thread>  thread;
+
+    void run();
+};
+
+typedef boost::shared_ptr<AsyncFormattingHandler> AsyncFormattingHandlerPtr;
+
+}
+}
+}
@@ -0,0 +1,50 @@
+/* ============================================================
+ *
+ * This file is part of the RSB project
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "DiscardingConverter.h"
+
+#include <rsc/runtime/TypeStringTools.h>
+
+#include <rsb/converter/SerializationException.h>
+
+using namespace std;
+
+using namespace rsb;
+using namespace rsb::converter;
+
+namespace rsb {
+namespace tools {
+namespace logger {
+
+DiscardingConverter::DiscardingConverter():
+    Converter<string>(rsc::runtime::typeName<void>(), "void", true) {
+}
+
+string DiscardingConverter::serialize(const AnnotatedData &/*data*/, string &/*wire*/) {
+    throw SerializationException("Discarded payloads cannot be serialized.");
+}
+
+AnnotatedData DiscardingConverter::deserialize(const string &/*wireSchema*/,
+                                               const string &/*wire*/) {
+    return make_pair(getDataType(), VoidPtr());
+}
+
+}
+}
+}
@@ -0,0 +1,51 @@
+/* ============================================================
+ *
+ * This file is part of the RSB project
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <string>
+
+#include <rsb/converter/Converter.h>
+
+namespace rsb {
+namespace tools {
+namespace logger {
+
+/**
+ * This converter accepts any wire schema and produces events without
+ * payload, neither deserializing nor copying the received bytes. It
+ * is used when the selected formatter does not look at payloads.
+ */
+class DiscardingConverter: public rsb::converter::Converter<std::string> {
+public:
+    DiscardingConverter();
+
+    /**
+     * @throw rsb::converter::SerializationException always, since
+     * discarded payloads cannot be restored.
+     */
+    std::string serialize(const rsb::AnnotatedData &data, std::string &wire);
+
+    rsb::AnnotatedData deserialize(const std::string &wireSchema,
+                                   const std::string &wire);
+};
+
+}
+}
+}
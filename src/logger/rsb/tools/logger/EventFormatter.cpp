@@ -28,6 +28,7 @@
 #include "MonitorEventFormatter.h"
 #endif
 #include "PayloadOnlyEventFormatter.h"
+#include "RecordEventFormatter.h"
 
 using namespace std;
 
@@ -42,6 +43,10 @@ namespace logger {
 EventFormatter::~EventFormatter() {
 }
 
+EventFormatter::PayloadRequirement EventFormatter::getPayloadRequirement() const {
+    return DESERIALIZED_PAYLOAD;
+}
+
 EventFormatterFactory::EventFormatterFactory() {
     this->register_("compact", &CompactEventFormatter::create);
     this->register_("detailed", &DetailedEventFormatter::create);
@@ -50,6 +55,7 @@ EventFormatterFactory::EventFormatterFactory() {
     this->register_("monitor", &MonitorEventFormatter::create);
 #endif
     this->register_("payload", &PayloadOnlyEventFormatter::create);
+    this->register_("record", &RecordEventFormatter::create);
 }
 
 set<string> getEventFormatterNames() {
@@ -41,8 +41,37 @@ namespace logger {
  */
 class EventFormatter {
 public:
+    /**
+     * Describes in which form a formatter needs the payloads of the
+     * events it formats. This determines the converters with which
+     * events are received.
+     */
+    enum PayloadRequirement {
+        /**
+         * Payloads are deserialized as far as possible.
+         */
+        DESERIALIZED_PAYLOAD,
+        /**
+         * Payloads are kept as wire schema and serialized bytes.
+         */
+        SERIALIZED_PAYLOAD,
+        /**
+         * Payloads are not used and are discarded on reception.
+         */
+        NO_PAYLOAD
+    };
+
     virtual ~EventFormatter();
 
+    /**
+     * Returns the form in which payloads have to be provided to
+     * @ref format. The default implementation requests deserialized
+     * payloads.
+     *
+     * @return The payload requirement of this formatter.
+     */
+    virtual PayloadRequirement getPayloadRequirement() const;
+
     /**
      * Format @a event onto @a stream ..
      *
@@ -0,0 +1,105 @@
+/* ============================================================
+ *
+ * This file is part of the RSB project
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "ListenScopes.h"
+
+#include <map>
+#include <set>
+
+using namespace std;
+
+using namespace rsb;
+
+namespace rsb {
+namespace tools {
+namespace logger {
+
+ListenScope::ListenScope(const Scope &scope):
+    scope(scope) {
+}
+
+vector<ListenScope> planListenScopes(const vector<string> &scopeTexts) {
+    set<Scope> literalScopes;
+    map<Scope, vector<ScopePattern> > patternsByPrefix;
+    for (vector<string>::const_iterator it = scopeTexts.begin();
+         it != scopeTexts.end(); ++it) {
+        ScopePattern pattern(*it);
+        if (pattern.hasWildcards()) {
+            patternsByPrefix[pattern.getPrefix()].push_back(pattern);
+        } else {
+            literalScopes.insert(pattern.getPrefix());
+        }
+    }
+
+    // Super-scopes sort before their sub-scopes, hence the scopes
+    // covering a scope have already been kept when it is visited.
+    vector<Scope> listenScopes;
+    for (set<Scope>::const_iterator it = literalScopes.begin();
+         it != literalScopes.end(); ++it) {
+        bool covered = false;
+        for (vector<Scope>::const_iterator kept = listenScopes.begin();
+             !covered && kept != listenScopes.end(); ++kept) {
+            covered = kept->isSuperScopeOf(*it);
+        }
+        if (!covered) {
+            listenScopes.push_back(*it);
+        }
+    }
+    map<Scope, vector<ScopePattern> > filteredScopes;
+    for (map<Scope, vector<ScopePattern> >::const_iterator it = patternsByPrefix.begin();
+         it != patternsByPrefix.end(); ++it) {
+        bool covered = false;
+        for (vector<Scope>::const_iterator kept = listenScopes.begin();
+             !covered && kept != listenScopes.end(); ++kept) {
+            covered = *kept == it->first || kept->isSuperScopeOf(it->first);
+        }
+        if (covered) {
+            continue;
+        }
+        map<Scope, vector<ScopePattern> >::iterator merged = filteredScopes.begin();
+        while (merged != filteredScopes.end() && !merged->first.isSuperScopeOf(it->first)) {
+            ++merged;
+        }
+        if (merged == filteredScopes.end()) {
+            filteredScopes[it->first] = it->second;
+        } else {
+            merged->second.insert(merged->second.end(), it->second.begin(), it->second.end());
+        }
+    }
+
+    vector<ListenScope> result(listenScopes.begin(), listenScopes.end());
+    for (map<Scope, vector<ScopePattern> >::const_iterator it = filteredScopes.begin();
+         it != filteredScopes.end(); ++it) {
+        ListenScope filtered(it->first);
+        filtered.patterns = it->second;
+        // Do not receive events twice via listeners on literal scopes.
+        for (vector<Scope>::const_iterator literal = listenScopes.begin();
+             literal != listenScopes.end(); ++literal) {
+            if (it->first.isSuperScopeOf(*literal)) {
+                filtered.excluded.push_back(*literal);
+            }
+        }
+        result.push_back(filtered);
+    }
+    return result;
+}
+
+}
+}
+}
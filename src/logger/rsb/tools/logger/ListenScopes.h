@@ -0,0 +1,60 @@
+/* ============================================================
+ *
+ * This file is part of the RSB project
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <rsb/Scope.h>
+
+#include "ScopePatternFilter.h"
+
+namespace rsb {
+namespace tools {
+namespace logger {
+
+/**
+ * A scope on which the logger listens. If @ref patterns is not
+ * empty, only events matching one of them and not on or below one of
+ * the @ref excluded scopes are logged.
+ */
+struct ListenScope {
+    ListenScope(const rsb::Scope &scope);
+
+    rsb::Scope                scope;
+    std::vector<ScopePattern> patterns;
+    std::vector<rsb::Scope>   excluded;
+};
+
+/**
+ * Plans as few listeners as possible which together receive the
+ * events on all scopes and scope patterns in @a scopeTexts exactly
+ * once. Scopes below other given scopes do not get their own
+ * listener. Patterns are handled by listeners on their literal
+ * prefixes, which exclude the scopes of other listeners below them.
+ *
+ * @throw std::invalid_argument if one of @a scopeTexts is not a
+ * valid scope or scope pattern.
+ */
+std::vector<ListenScope> planListenScopes(const std::vector<std::string> &scopeTexts);
+
+}
+}
+}
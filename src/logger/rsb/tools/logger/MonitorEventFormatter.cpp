@@ -173,6 +173,10 @@ EventFormatter* MonitorEventFormatter::create(const Properties &props) {
             props.get<double> ("print-frequency", 1.0));
 }
 
+EventFormatter::PayloadRequirement MonitorEventFormatter::getPayloadRequirement() const {
+    return NO_PAYLOAD;
+}
+
 void MonitorEventFormatter::format(ostream &/*stream*/, EventPtr event) {
     boost::recursive_mutex::scoped_lock lock(this->quantitiesMutex);
 
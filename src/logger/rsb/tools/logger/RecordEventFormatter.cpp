@@ -0,0 +1,108 @@
+/* ============================================================
+ *
+ * This file is part of the RSB project
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "RecordEventFormatter.h"
+
+#include <algorithm>
+
+#include <rsb/MetaData.h>
+
+#include <rsb/tools/simplebuffer/EventRecord.h>
+
+using namespace std;
+
+using namespace rsc::runtime;
+
+using namespace rsb;
+using namespace rsb::tools::simplebuffer;
+
+namespace rsb {
+namespace tools {
+namespace logger {
+
+RecordEventFormatter::RecordEventFormatter(ostream &stream):
+    stream(stream), offset(0), events(0), lastIndex(0), latestReceiveTime(0) {
+}
+
+RecordEventFormatter::~RecordEventFormatter() {
+    if (this->offset == 0) {
+        return;
+    }
+    if (!this->pendingIndex.empty()) {
+        writeIndex(this->stream);
+    }
+    this->body.clear();
+    encodeTrailer(this->lastIndex, this->body);
+    this->chunk.clear();
+    appendChunk(this->chunk, TRAILER_CHUNK, this->body);
+    this->stream.write(this->chunk.data(), this->chunk.size());
+    this->stream.flush();
+}
+
+EventFormatter* RecordEventFormatter::create(const Properties &props) {
+    return new RecordEventFormatter(*props.get<ostream*>("stream"));
+}
+
+EventFormatter::PayloadRequirement RecordEventFormatter::getPayloadRequirement() const {
+    return SERIALIZED_PAYLOAD;
+}
+
+void RecordEventFormatter::format(ostream &stream, EventPtr event) {
+    if (this->offset == 0) {
+        stream.write(RECORD_MAGIC.data(), RECORD_MAGIC.size());
+        this->offset = RECORD_MAGIC.size();
+    }
+
+    // Reuse the buffers of previous events to avoid allocations.
+    this->body.clear();
+    encodeEventRecord(event, this->body);
+    this->chunk.clear();
+    appendChunk(this->chunk, EVENT_CHUNK, this->body);
+
+    this->latestReceiveTime = max(this->latestReceiveTime,
+                                  event->getMetaData().getReceiveTime());
+    if (this->events % INDEX_STRIDE == 0) {
+        IndexEntry entry;
+        entry.receiveTime = this->latestReceiveTime;
+        entry.offset = this->offset;
+        this->pendingIndex.push_back(entry);
+    }
+    stream.write(this->chunk.data(), this->chunk.size());
+    this->offset += this->chunk.size();
+    ++this->events;
+
+    if (this->pendingIndex.size() >= INDEX_CHUNK_ENTRIES) {
+        writeIndex(stream);
+    }
+}
+
+void RecordEventFormatter::writeIndex(ostream &stream) {
+    this->body.clear();
+    encodeIndex(this->lastIndex, this->pendingIndex, this->body);
+    this->chunk.clear();
+    appendChunk(this->chunk, INDEX_CHUNK, this->body);
+    stream.write(this->chunk.data(), this->chunk.size());
+    this->lastIndex = this->offset;
+    this->offset += this->chunk.size();
+    this->pendingIndex.clear();
+}
+
+}
+}
+}
@@ -0,0 +1,74 @@
+/* ============================================================
+ *
+ * This file is part of the RSB project
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+#include "EventFormatter.h"
+#include "RecordFormat.h"
+
+namespace rsb {
+namespace tools {
+namespace logger {
+
+/**
+ * This formatter writes events with their meta data, causes and
+ * unconverted payloads into the binary container described in
+ * RecordFormat.h instead of printing them. Events have to be received
+ * with a SchemaAndByteArrayConverter.
+ *
+ * The container is completed with the remaining index and the
+ * trailer when the formatter is destroyed.
+ */
+class RecordEventFormatter: public EventFormatter {
+public:
+    /**
+     * @param stream The stream which receives all formatted events,
+     * onto which the index and trailer are written on destruction.
+     */
+    RecordEventFormatter(std::ostream &stream);
+
+    ~RecordEventFormatter();
+
+    static EventFormatter* create(const rsc::runtime::Properties &props);
+
+    PayloadRequirement getPayloadRequirement() const;
+
+    void format(std::ostream &stream, rsb::EventPtr event);
+private:
+    std::ostream            &stream;
+
+    boost::uint64_t          offset;
+    boost::uint64_t          events;
+    boost::uint64_t          lastIndex;
+    boost::uint64_t          latestReceiveTime;
+    std::vector<IndexEntry>  pendingIndex;
+
+    std::string              body;
+    std::string              chunk;
+
+    void writeIndex(std::ostream &stream);
+};
+
+}
+}
+}
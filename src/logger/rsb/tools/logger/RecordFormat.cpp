@@ -0,0 +1,91 @@
+/* ============================================================
+ *
+ * This file is part of the RSB project
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "RecordFormat.h"
+
+#include <rsb/tools/simplebuffer/BinaryEncoding.h>
+
+using namespace std;
+
+using namespace rsb::tools::simplebuffer;
+
+namespace rsb {
+namespace tools {
+namespace logger {
+
+const string RECORD_MAGIC = "RSBREC01";
+
+void appendChunk(string &out, ChunkType type, const string &body) {
+    out.push_back(char(type));
+    writeUint32(out, body.size());
+    out.append(body);
+}
+
+bool readChunkHeader(const char *data,
+                     size_t      size,
+                     size_t      offset,
+                     ChunkType  &type,
+                     size_t     &bodySize) {
+    if (offset > size || size - offset < CHUNK_HEADER_SIZE) {
+        return false;
+    }
+    type = ChunkType(data[offset]);
+    size_t lengthOffset = offset + 1;
+    bodySize = readUint32(data, size, lengthOffset);
+    return size - offset - CHUNK_HEADER_SIZE >= bodySize;
+}
+
+void encodeIndex(boost::uint64_t           previousIndex,
+                 const vector<IndexEntry> &entries,
+                 string                   &body) {
+    writeUint64(body, previousIndex);
+    writeUint32(body, entries.size());
+    for (vector<IndexEntry>::const_iterator it = entries.begin(); it != entries.end(); ++it) {
+        writeUint64(body, it->receiveTime);
+        writeUint64(body, it->offset);
+    }
+}
+
+boost::uint64_t decodeIndex(const char         *body,
+                            size_t              size,
+                            vector<IndexEntry> &entries) {
+    size_t offset = 0;
+    boost::uint64_t previousIndex = readUint64(body, size, offset);
+    boost::uint32_t count = readUint32(body, size, offset);
+    for (boost::uint32_t i = 0; i < count; ++i) {
+        IndexEntry entry;
+        entry.receiveTime = readUint64(body, size, offset);
+        entry.offset = readUint64(body, size, offset);
+        entries.push_back(entry);
+    }
+    return previousIndex;
+}
+
+void encodeTrailer(boost::uint64_t lastIndex, string &body) {
+    writeUint64(body, lastIndex);
+}
+
+boost::uint64_t decodeTrailer(const char *body, size_t size) {
+    size_t offset = 0;
+    return readUint64(body, size, offset);
+}
+
+}
+}
+}
@@ -0,0 +1,127 @@
+/* ============================================================
+ *
+ * This file is part of the RSB project
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+namespace rsb {
+namespace tools {
+namespace logger {
+
+/*
+ * Functions and constants defining the binary container in which the
+ * "record" style stores events.
+ *
+ * A container starts with @ref RECORD_MAGIC followed by chunks. Each
+ * chunk consists of a one byte @ref ChunkType, the little endian 32
+ * bit length of its body and the body. Event chunks contain one
+ * event with its unconverted payload, its meta data and its causes
+ * as encoded by simplebuffer::encodeEventRecord, which also encodes
+ * the events of buffer snapshots. Every @ref INDEX_STRIDE th event is listed in an index
+ * chunk, which refers to the previous index chunk. A trailer chunk
+ * at the end of a properly closed container refers to the last
+ * index chunk. Hence, readers can collect the whole index from the
+ * end of the container without scanning all events.
+ *
+ * Offsets are counted in bytes from the start of the container. The
+ * magic ensures that no chunk starts at offset 0, which therefore
+ * marks the absence of an index chunk.
+ */
+
+extern const std::string RECORD_MAGIC;
+
+enum ChunkType {
+    EVENT_CHUNK   = 'E',
+    INDEX_CHUNK   = 'I',
+    TRAILER_CHUNK = 'T'
+};
+
+/**
+ * Bytes of type and length preceding the body of each chunk.
+ */
+const std::size_t CHUNK_HEADER_SIZE = 5;
+
+/**
+ * Size of a complete trailer chunk.
+ */
+const std::size_t TRAILER_SIZE = CHUNK_HEADER_SIZE + 8;
+
+/**
+ * Every INDEX_STRIDE th event is added to the index.
+ */
+const unsigned int INDEX_STRIDE = 64;
+
+/**
+ * Number of index entries collected before an index chunk is written.
+ */
+const unsigned int INDEX_CHUNK_ENTRIES = 64;
+
+/**
+ * Events may be recorded out of the order of their receive
+ * timestamps, e.g. when listening on several scopes. Hence,
+ * @ref receiveTime is the latest receive timestamp of the indexed
+ * event and all events before it, which keeps index entries ordered
+ * by offset and receive time alike.
+ */
+struct IndexEntry {
+    boost::uint64_t receiveTime;
+    boost::uint64_t offset;
+};
+
+/**
+ * Appends a complete chunk to @a out.
+ */
+void appendChunk(std::string &out, ChunkType type, const std::string &body);
+
+/**
+ * Reads the header of the chunk starting at @a offset.
+ *
+ * @return @c false if fewer than a complete chunk is available, in
+ * which case @a type and @a bodySize are undefined.
+ */
+bool readChunkHeader(const char         *data,
+                     std::size_t         size,
+                     std::size_t         offset,
+                     ChunkType          &type,
+                     std::size_t        &bodySize);
+
+void encodeIndex(boost::uint64_t                previousIndex,
+                 const std::vector<IndexEntry> &entries,
+                 std::string                   &body);
+
+/**
+ * Appends the entries of an index chunk body to @a entries.
+ *
+ * @return The offset of the previous index chunk or 0.
+ */
+boost::uint64_t decodeIndex(const char              *body,
+                            std::size_t              size,
+                            std::vector<IndexEntry> &entries);
+
+void encodeTrailer(boost::uint64_t lastIndex, std::string &body);
+
+boost::uint64_t decodeTrailer(const char *body, std::size_t size);
+
+}
+}
+}
@@ -0,0 +1,161 @@
+/* ============================================================
+ *
+ * This file is part of the RSB project
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "ScopePatternFilter.h"
+
+#include <stdexcept>
+
+#include <boost/algorithm/string/classification.hpp>
+#include <boost/algorithm/string/join.hpp>
+#include <boost/algorithm/string/split.hpp>
+
+using namespace std;
+
+using namespace rsb;
+
+namespace rsb {
+namespace tools {
+namespace logger {
+
+namespace {
+
+/**
+ * Matches a single scope component against a pattern component in
+ * which "*" matches any sequence of characters.
+ */
+bool matchComponent(const char *pattern, const char *text) {
+    if (*pattern == '\0') {
+        return *text == '\0';
+    }
+    if (*pattern == '*') {
+        for (const char *rest = text; ; ++rest) {
+            if (matchComponent(pattern + 1, rest)) {
+                return true;
+            }
+            if (*rest == '\0') {
+                return false;
+            }
+        }
+    }
+    return *pattern == *text && matchComponent(pattern + 1, text + 1);
+}
+
+bool matchComponents(const vector<string> &pattern, size_t patternIndex,
+                     const vector<string> &scope,   size_t scopeIndex) {
+    if (patternIndex == pattern.size()) {
+        return scopeIndex == scope.size();
+    }
+    if (pattern[patternIndex] == "**") {
+        for (size_t rest = scopeIndex; rest <= scope.size(); ++rest) {
+            if (matchComponents(pattern, patternIndex + 1, scope, rest)) {
+                return true;
+            }
+        }
+        return false;
+    }
+    return scopeIndex < scope.size()
+        && matchComponent(pattern[patternIndex].c_str(), scope[scopeIndex].c_str())
+        && matchComponents(pattern, patternIndex + 1, scope, scopeIndex + 1);
+}
+
+}
+
+ScopePattern::ScopePattern(const string &pattern):
+    pattern(pattern), literalComponents(0) {
+    if (pattern.empty() || pattern[0] != '/') {
+        throw invalid_argument("Scope pattern " + pattern + " does not start with a slash.");
+    }
+    vector<string> parts;
+    boost::algorithm::split(parts, pattern, boost::algorithm::is_any_of("/"));
+    for (vector<string>::const_iterator it = parts.begin(); it != parts.end(); ++it) {
+        if (!it->empty()) {
+            this->components.push_back(*it);
+        }
+    }
+    while (this->literalComponents < this->components.size()
+           && !isPattern(this->components[this->literalComponents])) {
+        ++this->literalComponents;
+    }
+}
+
+bool ScopePattern::matches(const Scope &scope) const {
+    return matchComponents(this->components, 0, scope.getComponents(), 0);
+}
+
+Scope ScopePattern::getPrefix() const {
+    vector<string> literal(this->components.begin(),
+                           this->components.begin() + this->literalComponents);
+    return Scope("/" + boost::algorithm::join(literal, "/"));
+}
+
+bool ScopePattern::hasWildcards() const {
+    return this->literalComponents < this->components.size();
+}
+
+string ScopePattern::toString() const {
+    return this->pattern;
+}
+
+bool ScopePattern::isPattern(const string &text) {
+    return text.find('*') != string::npos;
+}
+
+ScopePatternFilter::ScopePatternFilter(const vector<ScopePattern> &patterns,
+                                       const vector<Scope>        &excluded):
+    patterns(patterns), excluded(excluded) {
+}
+
+bool ScopePatternFilter::match(EventPtr event) {
+    const Scope &scope = *event->getScopePtr();
+    for (vector<Scope>::const_iterator it = this->excluded.begin();
+         it != this->excluded.end(); ++it) {
+        if (*it == scope || it->isSuperScopeOf(scope)) {
+            return false;
+        }
+    }
+    for (vector<ScopePattern>::const_iterator it = this->patterns.begin();
+         it != this->patterns.end(); ++it) {
+        if (it->matches(scope)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+string ScopePatternFilter::getClassName() const {
+    return "ScopePatternFilter";
+}
+
+void ScopePatternFilter::printContents(ostream &stream) const {
+    stream << "patterns = [";
+    for (vector<ScopePattern>::const_iterator it = this->patterns.begin();
+         it != this->patterns.end(); ++it) {
+        stream << (it == this->patterns.begin() ? "" : ", ") << it->toString();
+    }
+    stream << "], excluded = [";
+    for (vector<Scope>::const_iterator it = this->excluded.begin();
+         it != this->excluded.end(); ++it) {
+        stream << (it == this->excluded.begin() ? "" : ", ") << *it;
+    }
+    stream << "]";
+}
+
+}
+}
+}
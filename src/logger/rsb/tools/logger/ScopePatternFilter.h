@@ -0,0 +1,95 @@
+/* ============================================================
+ *
+ * This file is part of the RSB project
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <rsb/Scope.h>
+#include <rsb/filter/Filter.h>
+
+namespace rsb {
+namespace tools {
+namespace logger {
+
+/**
+ * A scope pattern like /robot/&lowast;/camera/&lowast;&lowast;. In
+ * each component, "*" matches any sequence of characters. A
+ * component consisting of "**" matches any number of components.
+ */
+class ScopePattern {
+public:
+    /**
+     * @throw std::invalid_argument if @a pattern does not start with
+     * a slash.
+     */
+    ScopePattern(const std::string &pattern);
+
+    bool matches(const rsb::Scope &scope) const;
+
+    /**
+     * Returns the longest scope which is a super-scope of all scopes
+     * matched by this pattern. For patterns without wildcards this is
+     * the only matched scope.
+     */
+    rsb::Scope getPrefix() const;
+
+    bool hasWildcards() const;
+
+    std::string toString() const;
+
+    /**
+     * Tells whether @a text contains wildcards and thus has to be
+     * parsed as a pattern instead of a scope.
+     */
+    static bool isPattern(const std::string &text);
+private:
+    std::string              pattern;
+    std::vector<std::string> components;
+    std::size_t              literalComponents;
+};
+
+/**
+ * This filter accepts events on scopes matching any of several
+ * patterns, unless they are on or below one of the excluded scopes.
+ */
+class ScopePatternFilter: public rsb::filter::Filter {
+public:
+    /**
+     * @param patterns Events matching any of these patterns are
+     * accepted.
+     * @param excluded Events on these scopes or their sub-scopes are
+     * rejected, e.g. because they are received by another listener.
+     */
+    ScopePatternFilter(const std::vector<ScopePattern> &patterns,
+                       const std::vector<rsb::Scope>   &excluded = std::vector<rsb::Scope>());
+
+    bool match(rsb::EventPtr event);
+
+    std::string getClassName() const;
+    void printContents(std::ostream &stream) const;
+private:
+    std::vector<ScopePattern> patterns;
+    std::vector<rsb::Scope>   excluded;
+};
+
+}
+}
+}
@@ -161,6 +161,10 @@ EventFormatter* StatisticsEventFormatter::create(const Properties &props) {
                                         props.get<double>("print-frequency", 1.0));
 }
 
+EventFormatter::PayloadRequirement StatisticsEventFormatter::getPayloadRequirement() const {
+    return NO_PAYLOAD;
+}
+
 void StatisticsEventFormatter::format(ostream &/*stream*/, EventPtr event) {
     boost::recursive_mutex::scoped_lock lock(this->quantitiesMutex);
 
@@ -61,6 +61,8 @@ public:
 
     static EventFormatter* create(const rsc::runtime::Properties &props);
 
+    PayloadRequirement getPayloadRequirement() const;
+
     void format(std::ostream &stream, rsb::EventPtr event);
 private:
     typedef std::list<std::pair< std::string, QuantityPtr> > QuantitiesMap;
@@ -18,9 +18,13 @@
  * ============================================================ */
 
 #include <iostream>
+#include <map>
+#include <set>
+#include <vector>
 
 #include <boost/format.hpp>
 
+#include <boost/thread/mutex.hpp>
 #include <boost/thread/recursive_mutex.hpp>
 #include <boost/thread/condition.hpp>
 
@@ -37,11 +41,16 @@
 #include <rsb/converter/EventsByScopeMapConverter.h>
 #include <rsb/converter/PredicateConverterList.h>
 #include <rsb/converter/RegexConverterPredicate.h>
+#include <rsb/converter/SchemaAndByteArrayConverter.h>
 #include <rsb/converter/TypeNameConverterPredicate.h>
 #include <rsb/converter/StringConverter.h>
 
+#include "AsyncFormattingHandler.h"
+#include "DiscardingConverter.h"
 #include "EventFormatter.h"
+#include "ListenScopes.h"
 #include "PayloadFormatter.h"
+#include "ScopePatternFilter.h"
 
 using namespace std;
 
@@ -62,10 +71,13 @@ public:
     }
 
     void handle(EventPtr event) {
+        // Events from several listeners may arrive concurrently.
+        boost::mutex::scoped_lock lock(this->formatterMutex);
         this->formatter->format(std::cout, event);
     }
 private:
     EventFormatterPtr formatter;
+    boost::mutex      formatterMutex;
 };
 
 template <typename WireType>
@@ -109,8 +121,30 @@ typename ConverterSelectionStrategy<WireType>::Ptr createConverterSelectionStrat
     return typename ConverterSelectionStrategy<WireType>::Ptr(new PredicateConverterList<WireType>(converters.begin(), converters.end()));
 }
 
-string scope;
+template <typename WireType>
+typename ConverterSelectionStrategy<WireType>::Ptr createRawConverterSelectionStrategy() {
+    // Keep the wire schema and serialized bytes of all payloads, for
+    // example to record them.
+    list< pair<ConverterPredicatePtr, typename Converter<WireType>::Ptr> > converters;
+    converters.push_back(make_pair(ConverterPredicatePtr(new AlwaysApplicable()),
+                                   typename Converter<WireType>::Ptr(new SchemaAndByteArrayConverter())));
+    return typename ConverterSelectionStrategy<WireType>::Ptr(new PredicateConverterList<WireType>(converters.begin(), converters.end()));
+}
+
+template <typename WireType>
+typename ConverterSelectionStrategy<WireType>::Ptr createDiscardingConverterSelectionStrategy() {
+    // Drop all payloads without looking at them for formatters which
+    // only use meta data.
+    list< pair<ConverterPredicatePtr, typename Converter<WireType>::Ptr> > converters;
+    converters.push_back(make_pair(ConverterPredicatePtr(new AlwaysApplicable()),
+                                   typename Converter<WireType>::Ptr(new DiscardingConverter())));
+    return typename ConverterSelectionStrategy<WireType>::Ptr(new PredicateConverterList<WireType>(converters.begin(), converters.end()));
+}
+
+vector<string> scopes;
 string eventFormat;
+size_t queueSize;
+string overflowPolicy;
 
 options_description options("Allowed options");
 
@@ -119,15 +153,22 @@ bool handleCommandline(int argc, char *argv[]) {
     ("help",
      "Display a help message.")
     ("scope",
-     value<string>(&scope),
-     "The scope of the channel for which events should be logged.")
+     value< vector<string> >(&scopes),
+     "A scope of a channel for which events should be logged. May be given multiple times. Scopes may contain patterns in which \"*\" matches any part of a component and a \"**\" component matches any number of components, e.g. /robot/*/camera/**.")
     ("style",
      value<string>(&eventFormat)->default_value("compact"),
      boost::str(boost::format("The style that should be used to print received events. Value has to be one of %1%.")
-         % getEventFormatterNames()).c_str());
+         % getEventFormatterNames()).c_str())
+    ("queue-size",
+     value<size_t>(&queueSize)->default_value(10000),
+     "The number of received events which may wait for being printed by a separate thread. 0 prints events on the thread receiving them, which delays the reception of further events.")
+    ("overflow",
+     value<string>(&overflowPolicy)->default_value("block"),
+     boost::str(boost::format("The action to take when a received event does not fit into the queue. Value has to be one of %1%.")
+         % AsyncFormattingHandler::getPolicyNames()).c_str());
 
     positional_options_description positional_options;
-    positional_options.add("scope", 1);
+    positional_options.add("scope", -1);
 
     variables_map map;
     store(command_line_parser(argc, argv)
@@ -142,18 +183,41 @@ bool handleCommandline(int argc, char *argv[]) {
         throw invalid_argument(boost::str(boost::format("Argument of --format option has to one of %1%.")
                    % getEventFormatterNames()));
     }
-    if (scope.empty()) {
-        throw invalid_argument("A Scope has to be specified.");
+    if (!AsyncFormattingHandler::getPolicyNames().count(overflowPolicy)) {
+        throw invalid_argument(boost::str(boost::format("Argument of --overflow option has to be one of %1%.")
+                   % AsyncFormattingHandler::getPolicyNames()));
+    }
+    if (scopes.empty()) {
+        throw invalid_argument("At least one scope has to be specified.");
     }
 
     return false;
 }
 
 void usage() {
-    cout << "usage: logger SCOPE [OPTIONS]" << endl;
+    cout << "usage: logger SCOPE... [OPTIONS]" << endl;
     cout << options << endl;
 }
 
+/**
+ * Creates the listeners planned by planListenScopes for the scopes
+ * and scope patterns in @a scopeTexts.
+ */
+vector<ListenerPtr> createListeners(const vector<string>  &scopeTexts,
+                                    const ParticipantConfig &config) {
+    vector<ListenScope> plan = planListenScopes(scopeTexts);
+    vector<ListenerPtr> listeners;
+    for (vector<ListenScope>::const_iterator it = plan.begin();
+         it != plan.end(); ++it) {
+        ListenerPtr listener = getFactory().createListener(it->scope, config);
+        if (!it->patterns.empty()) {
+            listener->addFilter(filter::FilterPtr(new ScopePatternFilter(it->patterns, it->excluded)));
+        }
+        listeners.push_back(listener);
+    }
+    return listeners;
+}
+
 int main(int argc, char* argv[]) {
     // Handle commandline arguments.
     try {
@@ -174,7 +238,21 @@ int main(int argc, char* argv[]) {
     props["stream"] = &std::cout;
     EventFormatterPtr formatter(EventFormatterFactory::getInstance().createInst(eventFormat, props));
 
-    // Configure a Listener object.
+    // Configure a Listener object. Only decode payloads as far as
+    // the formatter needs them.
+    ConverterSelectionStrategy<string>::Ptr converters;
+    switch (formatter->getPayloadRequirement()) {
+    case EventFormatter::SERIALIZED_PAYLOAD:
+        converters = createRawConverterSelectionStrategy<string>();
+        break;
+    case EventFormatter::NO_PAYLOAD:
+        converters = createDiscardingConverterSelectionStrategy<string>();
+        break;
+    default:
+        converters = createConverterSelectionStrategy<string>();
+        break;
+    }
+
     ParticipantConfig config
         = getFactory().getDefaultParticipantConfig();
 
@@ -184,13 +262,47 @@ int main(int argc, char* argv[]) {
         ParticipantConfig::Transport& transport = config.mutableTransport(
                 it->getName());
         Properties options = transport.getOptions();
-        options["converters"] = createConverterSelectionStrategy<string>();
+        options["converters"] = converters;
         transport.setOptions(options);
     }
 
-    ListenerPtr listener
-        = getFactory().createListener(Scope(scope), config);
-    listener->addHandler(HandlerPtr(new FormattingHandler(formatter)));
+    vector<ListenerPtr> listeners;
+    try {
+        listeners = createListeners(scopes, config);
+    } catch (const std::exception& e) {
+        cerr << "Invalid scope: " << e.what() << endl;
+        return EXIT_FAILURE;
+    }
+    AsyncFormattingHandlerPtr asyncHandler;
+    HandlerPtr handler;
+    if (queueSize > 0) {
+        asyncHandler.reset(new AsyncFormattingHandler(formatter, std::cout, queueSize,
+                                                      AsyncFormattingHandler::policyFromName(overflowPolicy)));
+        handler = asyncHandler;
+    } else {
+        handler.reset(new FormattingHandler(formatter));
+    }
+    // All listeners share the handler and thus the output pipeline.
+    for (vector<ListenerPtr>::const_iterator it = listeners.begin();
+         it != listeners.end(); ++it) {
+        (*it)->addHandler(handler);
+    }
+
+    rsc::misc::Signal signal = rsc::misc::waitForSignal();
+
+    // Print the events which have been received so far.
+    for (vector<ListenerPtr>::const_iterator it = listeners.begin();
+         it != listeners.end(); ++it) {
+        (*it)->removeHandler(handler);
+    }
+    if (asyncHandler) {
+        asyncHandler->stop();
+        if (asyncHandler->getDroppedOldest() || asyncHandler->getDroppedNewest()) {
+            cerr << "Dropped " << asyncHandler->getDroppedOldest() << " queued and "
+                 << asyncHandler->getDroppedNewest() << " received events because the output was too slow."
+                 << endl;
+        }
+    }
 
-    return rsc::misc::suggestedExitCode(rsc::misc::waitForSignal());
+    return rsc::misc::suggestedExitCode(signal);
 }
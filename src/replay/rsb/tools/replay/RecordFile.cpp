@@ -0,0 +1,215 @@
+/* ============================================================
+ *
+ * This file is part of the RSB project
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "RecordFile.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <boost/format.hpp>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <rsb/MetaData.h>
+
+#include <rsb/tools/simplebuffer/EventRecord.h>
+
+using namespace std;
+
+using namespace rsb;
+using namespace rsb::tools::logger;
+using namespace rsb::tools::simplebuffer;
+
+namespace rsb {
+namespace tools {
+namespace replay {
+
+namespace {
+
+bool earlierThan(const IndexEntry &entry, boost::uint64_t receiveTime) {
+    return entry.receiveTime < receiveTime;
+}
+
+bool lowerOffset(const IndexEntry &a, const IndexEntry &b) {
+    return a.offset < b.offset;
+}
+
+}
+
+RecordFile::RecordFile(const string &path):
+    data(0), size(0), end(0), complete(false) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw runtime_error("Could not open " + path + ": " + strerror(errno));
+    }
+    struct stat status;
+    if (fstat(fd, &status) != 0) {
+        string error = strerror(errno);
+        close(fd);
+        throw runtime_error("Could not stat " + path + ": " + error);
+    }
+    this->size = status.st_size;
+    if (this->size < RECORD_MAGIC.size()) {
+        close(fd);
+        throw runtime_error(path + " is not a recorded container.");
+    }
+    void *mapping = mmap(0, this->size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        throw runtime_error("Could not map " + path + ": " + strerror(errno));
+    }
+    this->data = static_cast<const char*>(mapping);
+    if (RECORD_MAGIC.compare(0, RECORD_MAGIC.size(), this->data, RECORD_MAGIC.size()) != 0) {
+        munmap(const_cast<char*>(this->data), this->size);
+        throw runtime_error(path + " is not a recorded container.");
+    }
+    // Events are mostly read front to back.
+    madvise(const_cast<char*>(this->data), this->size, MADV_SEQUENTIAL);
+
+    if (!readIndexFromTrailer()) {
+        readIndexByScanning();
+    }
+}
+
+RecordFile::~RecordFile() {
+    munmap(const_cast<char*>(this->data), this->size);
+}
+
+bool RecordFile::readIndexFromTrailer() {
+    if (this->size < RECORD_MAGIC.size() + TRAILER_SIZE) {
+        return false;
+    }
+    size_t trailer = this->size - TRAILER_SIZE;
+    ChunkType type;
+    size_t bodySize;
+    if (!readChunkHeader(this->data, this->size, trailer, type, bodySize)
+        || type != TRAILER_CHUNK || bodySize != TRAILER_SIZE - CHUNK_HEADER_SIZE) {
+        return false;
+    }
+
+    // Each index chunk has to refer to an earlier one. Otherwise, a
+    // damaged chain could be followed forever.
+    vector<IndexEntry> entries;
+    boost::uint64_t limit = trailer;
+    boost::uint64_t indexOffset = decodeTrailer(this->data + trailer + CHUNK_HEADER_SIZE, bodySize);
+    while (indexOffset != 0) {
+        if (indexOffset >= limit
+            || !readChunkHeader(this->data, trailer, indexOffset, type, bodySize)
+            || type != INDEX_CHUNK) {
+            return false;
+        }
+        limit = indexOffset;
+        try {
+            indexOffset = decodeIndex(this->data + indexOffset + CHUNK_HEADER_SIZE, bodySize, entries);
+        } catch (const out_of_range &) {
+            return false;
+        }
+    }
+    // Index chunks have been visited from the last to the first one.
+    sort(entries.begin(), entries.end(), lowerOffset);
+
+    this->index.swap(entries);
+    this->end = trailer;
+    this->complete = true;
+    return true;
+}
+
+void RecordFile::readIndexByScanning() {
+    size_t offset = RECORD_MAGIC.size();
+    ChunkType type;
+    size_t bodySize;
+    while (readChunkHeader(this->data, this->size, offset, type, bodySize)) {
+        if (type == INDEX_CHUNK) {
+            // Damaged index chunks are skipped, seeking then decodes
+            // more events.
+            vector<IndexEntry> entries;
+            try {
+                decodeIndex(this->data + offset + CHUNK_HEADER_SIZE, bodySize, entries);
+                this->index.insert(this->index.end(), entries.begin(), entries.end());
+            } catch (const out_of_range &) {
+            }
+        }
+        offset += CHUNK_HEADER_SIZE + bodySize;
+    }
+    this->end = offset;
+}
+
+size_t RecordFile::begin() const {
+    return RECORD_MAGIC.size();
+}
+
+size_t RecordFile::seek(boost::uint64_t receiveTime) const {
+    // Index entries carry the latest receive time up to the indexed
+    // event. Hence, no event up to the last entry before receiveTime
+    // has been received at or after it.
+    vector<IndexEntry>::const_iterator it
+        = lower_bound(this->index.begin(), this->index.end(), receiveTime, earlierThan);
+    size_t offset = begin();
+    if (it != this->index.begin()) {
+        offset = (it - 1)->offset;
+    }
+
+    size_t current = offset;
+    EventPtr event;
+    while ((event = next(offset))) {
+        if (event->getMetaData().getReceiveTime() >= receiveTime) {
+            break;
+        }
+        current = offset;
+    }
+    return current;
+}
+
+EventPtr RecordFile::next(size_t &offset) const {
+    ChunkType type;
+    size_t bodySize;
+    while (readChunkHeader(this->data, this->end, offset, type, bodySize)) {
+        const size_t chunk = offset;
+        const char *body = this->data + offset + CHUNK_HEADER_SIZE;
+        offset += CHUNK_HEADER_SIZE + bodySize;
+        if (type == EVENT_CHUNK) {
+            try {
+                return decodeEventRecord(body, bodySize);
+            } catch (const std::exception& e) {
+                throw runtime_error(boost::str(boost::format("Could not decode the event chunk at offset %1%: %2%")
+                                               % chunk % e.what()));
+            }
+        }
+    }
+    return EventPtr();
+}
+
+boost::uint64_t RecordFile::getFirstReceiveTime() const {
+    size_t offset = begin();
+    EventPtr event = next(offset);
+    return event ? event->getMetaData().getReceiveTime() : 0;
+}
+
+bool RecordFile::isComplete() const {
+    return this->complete;
+}
+
+}
+}
+}
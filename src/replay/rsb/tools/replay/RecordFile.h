@@ -0,0 +1,116 @@
+/* ============================================================
+ *
+ * This file is part of the RSB project
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+
+#include <rsb/Event.h>
+
+#include "rsb/tools/logger/RecordFormat.h"
+
+namespace rsb {
+namespace tools {
+namespace replay {
+
+/**
+ * Read access to a container written by the "record" style of the
+ * logger. The file is mapped into memory so that events are decoded
+ * directly from the page cache without copying them into buffers
+ * first.
+ *
+ * On opening, the index is collected via the trailer. If the
+ * container was not closed properly, e.g. because the logger was
+ * killed, the chunks are scanned instead and a truncated last chunk
+ * is ignored.
+ */
+class RecordFile: private boost::noncopyable {
+public:
+    /**
+     * Maps the container at @a path.
+     *
+     * @throw std::runtime_error if the file cannot be mapped or is
+     * not a recorded container.
+     */
+    RecordFile(const std::string &path);
+
+    ~RecordFile();
+
+    /**
+     * Returns the offset of the first event chunk.
+     */
+    std::size_t begin() const;
+
+    /**
+     * Returns the offset of the first event in the container which
+     * was received at or after @a receiveTime. Events may have been
+     * recorded out of the order of their receive timestamps. Only the
+     * events following the closest index entry are decoded.
+     *
+     * @throw std::runtime_error if an event chunk cannot be decoded.
+     */
+    std::size_t seek(boost::uint64_t receiveTime) const;
+
+    /**
+     * Decodes the event at or after @a offset and advances @a offset
+     * to the following chunk.
+     *
+     * @return The decoded event or an empty pointer at the end of the
+     * container.
+     * @throw std::runtime_error if the event chunk cannot be decoded.
+     * The message contains its offset.
+     */
+    rsb::EventPtr next(std::size_t &offset) const;
+
+    /**
+     * Returns the receive timestamp of the first recorded event or 0
+     * if the container is empty.
+     *
+     * @throw std::runtime_error if the first event chunk cannot be
+     * decoded.
+     */
+    boost::uint64_t getFirstReceiveTime() const;
+
+    /**
+     * Tells whether the index was read via the trailer.
+     */
+    bool isComplete() const;
+private:
+    const char                             *data;
+    std::size_t                             size;
+
+    /**
+     * Offset after the last complete chunk.
+     */
+    std::size_t                             end;
+    bool                                    complete;
+
+    std::vector<rsb::tools::logger::IndexEntry> index;
+
+    bool readIndexFromTrailer();
+    void readIndexByScanning();
+};
+
+}
+}
+}
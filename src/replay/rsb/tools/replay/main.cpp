@@ -0,0 +1,224 @@
+/* ============================================================
+ *
+ * This file is part of the RSB project
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include <iostream>
+#include <map>
+
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+#include <boost/thread.hpp>
+
+#include <rsc/misc/langutils.h>
+
+#include <rsb/Factory.h>
+#include <rsb/MetaData.h>
+
+#include <rsb/converter/PredicateConverterList.h>
+#include <rsb/converter/SchemaAndByteArrayConverter.h>
+
+#include "RecordFile.h"
+
+using namespace std;
+
+using namespace boost::program_options;
+
+using namespace rsc::runtime;
+
+using namespace rsb;
+using namespace rsb::converter;
+
+using namespace rsb::tools::replay;
+
+string file;
+double startSec;
+double endSec;
+double speed;
+string prefix;
+
+options_description options("Allowed options");
+
+bool handleCommandline(int argc, char *argv[]) {
+    options.add_options()
+    ("help",
+     "Display a help message.")
+    ("file",
+     value<string>(&file),
+     "The file written by the record style of the logger.")
+    ("start",
+     value<double>(&startSec)->default_value(0.0),
+     "Seconds after the first recorded event at which to start the replay.")
+    ("end",
+     value<double>(&endSec)->default_value(0.0),
+     "Seconds after the first recorded event at which to stop the replay. 0 replays until the end of the file.")
+    ("speed",
+     value<double>(&speed)->default_value(1.0),
+     "Factor by which the replay is faster than the recording, e.g. 1 for real-time or 0.5 for half speed. 0 replays events as fast as possible.")
+    ("prefix",
+     value<string>(&prefix),
+     "A scope to prepend to the scopes of replayed events, e.g. to keep them apart from live events.");
+
+    positional_options_description positional_options;
+    positional_options.add("file", 1);
+
+    variables_map map;
+    store(command_line_parser(argc, argv)
+      .options(options)
+      .positional(positional_options)
+      .run(), map);
+    notify(map);
+    if (map.count("help")) {
+        return true;
+    }
+    if (file.empty()) {
+        throw invalid_argument("A file has to be specified.");
+    }
+    if (speed < 0.0 || startSec < 0.0 || endSec < 0.0) {
+        throw invalid_argument("Start, end and speed must not be negative.");
+    }
+
+    return false;
+}
+
+void usage() {
+    cout << "usage: replay FILE [OPTIONS]" << endl;
+    cout << options << endl;
+}
+
+ParticipantConfig getRawConfig() {
+    // Publish the recorded wire schemas and bytes without conversion.
+    list< pair<ConverterPredicatePtr, Converter<string>::Ptr> > converters;
+    converters.push_back(make_pair(ConverterPredicatePtr(new AlwaysApplicable()),
+                                   Converter<string>::Ptr(new SchemaAndByteArrayConverter())));
+    ConverterSelectionStrategy<string>::Ptr strategy(
+        new PredicateConverterList<string>(converters.begin(), converters.end()));
+
+    ParticipantConfig config = getFactory().getDefaultParticipantConfig();
+    set<ParticipantConfig::Transport> transports = config.getTransports();
+    for (set<ParticipantConfig::Transport>::const_iterator it =
+            transports.begin(); it != transports.end(); ++it) {
+        ParticipantConfig::Transport& transport = config.mutableTransport(
+                it->getName());
+        Properties options = transport.getOptions();
+        options["converters"] = strategy;
+        transport.setOptions(options);
+    }
+    return config;
+}
+
+/**
+ * Creates a new event from a recorded one which only keeps the
+ * properties that are not assigned anew when publishing it.
+ */
+EventPtr createReplayEvent(EventPtr recorded) {
+    Scope scope = *recorded->getScopePtr();
+    if (!prefix.empty()) {
+        scope = Scope(prefix).concat(scope);
+    }
+    EventPtr event(new Event(scope, recorded->getData(), recorded->getType(),
+                             recorded->getMethod()));
+    const MetaData &metaData = recorded->getMetaData();
+    for (map<string, boost::uint64_t>::const_iterator it = metaData.userTimesBegin();
+         it != metaData.userTimesEnd(); ++it) {
+        event->mutableMetaData().setUserTime(it->first, it->second);
+    }
+    for (map<string, string>::const_iterator it = metaData.userInfosBegin();
+         it != metaData.userInfosEnd(); ++it) {
+        event->mutableMetaData().setUserInfo(it->first, it->second);
+    }
+    set<EventId> causes = recorded->getCauses();
+    for (set<EventId>::const_iterator it = causes.begin(); it != causes.end(); ++it) {
+        event->addCause(*it);
+    }
+    return event;
+}
+
+int main(int argc, char* argv[]) {
+    // Handle commandline arguments.
+    try {
+        if (handleCommandline(argc, argv)) {
+            usage(); // --help
+            return EXIT_SUCCESS;
+        }
+    } catch (const std::exception& e) {
+        cerr << "Error parsing command line: " << e.what() << endl;
+        usage();
+        return EXIT_FAILURE;
+    }
+
+    boost::shared_ptr<RecordFile> record;
+    try {
+        record.reset(new RecordFile(file));
+    } catch (const std::exception& e) {
+        cerr << e.what() << endl;
+        return EXIT_FAILURE;
+    }
+    if (!record->isComplete()) {
+        cerr << "The file has not been closed properly, replaying the complete events." << endl;
+    }
+
+    ParticipantConfig config = getRawConfig();
+    map<Scope, InformerBasePtr> informers;
+
+    boost::uint64_t replayStart = rsc::misc::currentTimeMicros();
+    boost::uint64_t replayed = 0;
+    try {
+        boost::uint64_t firstTime = record->getFirstReceiveTime();
+        boost::uint64_t startTime = firstTime + boost::uint64_t(startSec * 1000000);
+        boost::uint64_t endTime = endSec > 0.0
+            ? firstTime + boost::uint64_t(endSec * 1000000) : 0;
+        size_t offset = startSec > 0.0 ? record->seek(startTime) : record->begin();
+
+        replayStart = rsc::misc::currentTimeMicros();
+        EventPtr recorded;
+        while ((recorded = record->next(offset))) {
+            boost::uint64_t receiveTime = recorded->getMetaData().getReceiveTime();
+            if (endTime != 0 && receiveTime >= endTime) {
+                break;
+            }
+
+            if (speed > 0.0 && receiveTime > startTime) {
+                boost::uint64_t due = replayStart
+                    + boost::uint64_t((receiveTime - startTime) / speed);
+                boost::uint64_t now = rsc::misc::currentTimeMicros();
+                if (due > now) {
+                    boost::this_thread::sleep(boost::posix_time::microseconds(due - now));
+                }
+            }
+
+            EventPtr event = createReplayEvent(recorded);
+            InformerBasePtr &informer = informers[*event->getScopePtr()];
+            if (!informer) {
+                informer = getFactory().createInformerBase(*event->getScopePtr(), "", config);
+            }
+            informer->publish(event);
+            ++replayed;
+        }
+    } catch (const std::exception& e) {
+        cerr << e.what() << endl;
+        cerr << "Stopped after replaying " << replayed << " events." << endl;
+        return EXIT_FAILURE;
+    }
+
+    double elapsedSec = double(rsc::misc::currentTimeMicros() - replayStart) / 1e6;
+    cerr << boost::format("Replayed %1% events in %2$.3f s (%3$.0f events/s)")
+        % replayed % elapsedSec % (elapsedSec > 0.0 ? replayed / elapsedSec : 0.0)
+         << endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,60 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "BatchRequestCallback.h"
+
+using namespace std;
+using namespace rsb;
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+BatchRequestCallback::BatchRequestCallback(BufferPtr buffer) :
+        buffer(buffer) {
+}
+
+BatchRequestCallback::~BatchRequestCallback() {
+}
+
+boost::shared_ptr<EventsByScopeMap> BatchRequestCallback::call(
+        const string &/*methodName*/, EventIdListPtr input) {
+
+    boost::shared_ptr<EventsByScopeMap> result(new EventsByScopeMap);
+    for (EventIdList::const_iterator it = input->begin(); it != input->end();
+            ++it) {
+        EventPtr event = buffer->get(*it);
+        if (event) {
+            (*result)[*event->getScopePtr()].push_back(event);
+        }
+    }
+    return result;
+
+}
+
+}
+}
+}
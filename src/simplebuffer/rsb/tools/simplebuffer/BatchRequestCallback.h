@@ -0,0 +1,59 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <rsb/EventCollections.h>
+#include <rsb/patterns/LocalServer.h>
+
+#include "Buffer.h"
+#include "EventIdListConverter.h"
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * Answers requests for multiple events by their ids in a single reply.
+ * Events which are not buffered are omitted from the reply.
+ */
+class BatchRequestCallback: public rsb::patterns::LocalServer::Callback<
+        EventIdList, rsb::EventsByScopeMap> {
+public:
+    BatchRequestCallback(BufferPtr buffer);
+    virtual ~BatchRequestCallback();
+
+    boost::shared_ptr<rsb::EventsByScopeMap> call(
+            const std::string &methodName, EventIdListPtr input);
+
+private:
+    BufferPtr buffer;
+
+};
+
+}
+}
+}
@@ -0,0 +1,106 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "BinaryEncoding.h"
+
+#include <stdexcept>
+
+using namespace std;
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+namespace {
+
+template<class T>
+void writeLittleEndian(string &wire, const T &value) {
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        wire.push_back(char((value >> (8 * i)) & 0xff));
+    }
+}
+
+template<class T>
+T readLittleEndian(const char *data, const size_t &size, size_t &offset) {
+    if (offset > size || size - offset < sizeof(T)) {
+        throw out_of_range("Not enough bytes to decode an integer.");
+    }
+    T value = 0;
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        value |= T((unsigned char) data[offset + i]) << (8 * i);
+    }
+    offset += sizeof(T);
+    return value;
+}
+
+}
+
+void writeUint32(string &wire, const boost::uint32_t &value) {
+    writeLittleEndian(wire, value);
+}
+
+void writeUint64(string &wire, const boost::uint64_t &value) {
+    writeLittleEndian(wire, value);
+}
+
+void writeString(string &wire, const string &value) {
+    writeUint32(wire, value.size());
+    wire.append(value);
+}
+
+boost::uint32_t readUint32(const string &wire, size_t &offset) {
+    return readLittleEndian<boost::uint32_t>(wire.data(), wire.size(),
+            offset);
+}
+
+boost::uint64_t readUint64(const string &wire, size_t &offset) {
+    return readLittleEndian<boost::uint64_t>(wire.data(), wire.size(),
+            offset);
+}
+
+boost::uint32_t readUint32(const char *data, const size_t &size,
+        size_t &offset) {
+    return readLittleEndian<boost::uint32_t>(data, size, offset);
+}
+
+boost::uint64_t readUint64(const char *data, const size_t &size,
+        size_t &offset) {
+    return readLittleEndian<boost::uint64_t>(data, size, offset);
+}
+
+string readString(const char *data, const size_t &size, size_t &offset) {
+    size_t length = readUint32(data, size, offset);
+    if (size - offset < length) {
+        throw out_of_range("Not enough bytes to decode a string.");
+    }
+    string value(data + offset, length);
+    offset += length;
+    return value;
+}
+
+}
+}
+}
@@ -0,0 +1,96 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <string>
+
+#include <boost/cstdint.hpp>
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * Appends @a value to @a wire in little endian byte order.
+ */
+void writeUint32(std::string &wire, const boost::uint32_t &value);
+
+/**
+ * Appends @a value to @a wire in little endian byte order.
+ */
+void writeUint64(std::string &wire, const boost::uint64_t &value);
+
+/**
+ * Appends the length of @a value as written by #writeUint32 followed by its
+ * bytes to @a wire.
+ */
+void writeString(std::string &wire, const std::string &value);
+
+/**
+ * Reads a value written with #writeUint32 and advances @a offset.
+ *
+ * @throw std::out_of_range not enough bytes left in @a wire
+ */
+boost::uint32_t readUint32(const std::string &wire, std::size_t &offset);
+
+/**
+ * Reads a value written with #writeUint64 and advances @a offset.
+ *
+ * @throw std::out_of_range not enough bytes left in @a wire
+ */
+boost::uint64_t readUint64(const std::string &wire, std::size_t &offset);
+
+/**
+ * Reads a value written with #writeUint32 from @a size bytes at @a data, e.g.
+ * a memory mapped file, and advances @a offset.
+ *
+ * @throw std::out_of_range not enough bytes left in @a data
+ */
+boost::uint32_t readUint32(const char *data, const std::size_t &size,
+        std::size_t &offset);
+
+/**
+ * Reads a value written with #writeUint64 from @a size bytes at @a data and
+ * advances @a offset.
+ *
+ * @throw std::out_of_range not enough bytes left in @a data
+ */
+boost::uint64_t readUint64(const char *data, const std::size_t &size,
+        std::size_t &offset);
+
+/**
+ * Reads a value written with #writeString from @a size bytes at @a data and
+ * advances @a offset.
+ *
+ * @throw std::out_of_range not enough bytes left in @a data
+ */
+std::string readString(const char *data, const std::size_t &size,
+        std::size_t &offset);
+
+}
+}
+}
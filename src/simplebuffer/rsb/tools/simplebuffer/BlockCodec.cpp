@@ -0,0 +1,241 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "BlockCodec.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+using namespace std;
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+namespace {
+
+const size_t MIN_MATCH = 4;
+
+/**
+ * The last match has to start this many bytes before the end of the block.
+ */
+const size_t MATCH_START_LIMIT = 12;
+
+/**
+ * The last bytes of a block are always literals.
+ */
+const size_t LAST_LITERALS = 5;
+
+const size_t MAX_OFFSET = 65535;
+
+const unsigned int HASH_BITS = 12;
+
+inline boost::uint32_t read32(const char *data) {
+    boost::uint32_t value;
+    memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+inline size_t hash32(const boost::uint32_t &value) {
+    return (value * 2654435761U) >> (32 - HASH_BITS);
+}
+
+void writeLength(string &output, size_t length) {
+    while (length >= 255) {
+        output.push_back(char(255));
+        length -= 255;
+    }
+    output.push_back(char(length));
+}
+
+void writeSequence(string &output, const char *literals,
+        const size_t &literalLength, const size_t &offset,
+        const size_t &matchLength) {
+
+    size_t matchCode = matchLength - MIN_MATCH;
+    output.push_back(
+            char(
+                    ((literalLength < 15 ? literalLength : 15) << 4)
+                            | (matchCode < 15 ? matchCode : 15)));
+    if (literalLength >= 15) {
+        writeLength(output, literalLength - 15);
+    }
+    output.append(literals, literalLength);
+    output.push_back(char(offset & 0xff));
+    output.push_back(char(offset >> 8));
+    if (matchCode >= 15) {
+        writeLength(output, matchCode - 15);
+    }
+
+}
+
+void writeLastLiterals(string &output, const char *literals,
+        const size_t &literalLength) {
+    output.push_back(char((literalLength < 15 ? literalLength : 15) << 4));
+    if (literalLength >= 15) {
+        writeLength(output, literalLength - 15);
+    }
+    output.append(literals, literalLength);
+}
+
+size_t readLength(const char *data, const size_t &size, size_t &offset) {
+    size_t length = 0;
+    unsigned char byte;
+    do {
+        if (offset >= size) {
+            throw invalid_argument("Truncated length in compressed block.");
+        }
+        byte = data[offset++];
+        length += byte;
+    } while (byte == 255);
+    return length;
+}
+
+}
+
+void compressBlock(const string &input, string &output) {
+
+    const char *source = input.data();
+    const size_t size = input.size();
+    output.reserve(output.size() + size + size / 255 + 16);
+
+    size_t anchor = 0;
+    if (size > MATCH_START_LIMIT) {
+
+        // positions + 1 of the last occurrence of each hashed 4 byte sequence
+        vector<boost::uint32_t> table(size_t(1) << HASH_BITS, 0);
+        const size_t matchStartLimit = size - MATCH_START_LIMIT;
+        const size_t matchEndLimit = size - LAST_LITERALS;
+
+        size_t position = 0;
+        while (position < matchStartLimit) {
+
+            boost::uint32_t sequence = read32(source + position);
+            size_t slot = hash32(sequence);
+            size_t candidate = table[slot];
+            table[slot] = position + 1;
+
+            if (candidate == 0 || position - (candidate - 1) > MAX_OFFSET
+                    || read32(source + candidate - 1) != sequence) {
+                ++position;
+                continue;
+            }
+            --candidate;
+
+            size_t length = MIN_MATCH;
+            while (position + length < matchEndLimit
+                    && source[candidate + length] == source[position + length]) {
+                ++length;
+            }
+
+            writeSequence(output, source + anchor, position - anchor,
+                    position - candidate, length);
+            position += length;
+            anchor = position;
+
+        }
+
+    }
+    writeLastLiterals(output, source + anchor, size - anchor);
+
+}
+
+void decompressBlock(const char *data, const size_t &size,
+        const size_t &originalSize, string &output) {
+
+    const size_t start = output.size();
+    output.resize(start + originalSize);
+    char *target = originalSize == 0 ? 0 : &output[start];
+
+    size_t in = 0;
+    size_t out = 0;
+    while (true) {
+
+        if (in >= size) {
+            throw invalid_argument("Truncated compressed block.");
+        }
+        unsigned char token = data[in++];
+
+        size_t literalLength = token >> 4;
+        if (literalLength == 15) {
+            literalLength += readLength(data, size, in);
+        }
+        if (literalLength > size - in || literalLength > originalSize - out) {
+            throw invalid_argument("Literals exceed the compressed block.");
+        }
+        if (literalLength > 0) {
+            memcpy(target + out, data + in, literalLength);
+        }
+        in += literalLength;
+        out += literalLength;
+
+        if (in == size) {
+            break;
+        }
+
+        if (size - in < 2) {
+            throw invalid_argument("Truncated match offset.");
+        }
+        size_t offset = (unsigned char) data[in]
+                | (size_t((unsigned char) data[in + 1]) << 8);
+        in += 2;
+        if (offset == 0 || offset > out) {
+            throw invalid_argument("Invalid match offset.");
+        }
+
+        size_t matchLength = token & 0x0f;
+        if (matchLength == 15) {
+            matchLength += readLength(data, size, in);
+        }
+        matchLength += MIN_MATCH;
+        if (matchLength > originalSize - out) {
+            throw invalid_argument("Match exceeds the original size.");
+        }
+        if (offset >= matchLength) {
+            memcpy(target + out, target + out - offset, matchLength);
+        } else {
+            // overlapping matches repeat the last offset bytes
+            for (size_t i = 0; i < matchLength; ++i) {
+                target[out + i] = target[out + i - offset];
+            }
+        }
+        out += matchLength;
+
+    }
+
+    if (out != originalSize) {
+        throw invalid_argument(
+                "Compressed block does not match the original size.");
+    }
+
+}
+
+}
+}
+}
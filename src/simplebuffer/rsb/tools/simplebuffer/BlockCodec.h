@@ -0,0 +1,61 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * Compresses @a input into the LZ4 block format with a single greedy pass
+ * and appends the result to @a output. The original size is not stored and
+ * has to be passed to #decompressBlock.
+ *
+ * @param input bytes to compress
+ * @param output compressed bytes are appended here
+ */
+void compressBlock(const std::string &input, std::string &output);
+
+/**
+ * Decompresses an LZ4 block.
+ *
+ * @param data start of the compressed block
+ * @param size number of compressed bytes
+ * @param originalSize number of bytes the block decompresses to
+ * @param output decompressed bytes are appended here
+ * @throw std::invalid_argument the block is corrupt or does not decompress
+ *                              to @a originalSize bytes
+ */
+void decompressBlock(const char *data, const std::size_t &size,
+        const std::size_t &originalSize, std::string &output);
+
+}
+}
+}
@@ -0,0 +1,94 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "BloomFilteredBuffer.h"
+
+#include <rsb/MetaData.h>
+
+using namespace std;
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+BloomFilteredBuffer::BloomFilteredBuffer(BufferPtr buffer,
+        const boost::uint64_t &deltaInMuSec, const size_t &expectedEvents) :
+        logger(rsc::logging::Logger::getLogger("rsbbuffer.BloomFilteredBuffer")), buffer(
+                buffer), filter(deltaInMuSec, expectedEvents), filteredMisses(
+                0), unfilteredMisses(0) {
+    RSCDEBUG(logger,
+            "Using " << filter.getBitsPerGeneration() << " bits for each of the " << RotatingBloomFilter::GENERATIONS << " filter generations");
+}
+
+BloomFilteredBuffer::~BloomFilteredBuffer() {
+}
+
+void BloomFilteredBuffer::insert(rsb::EventPtr event) {
+    filter.advance(event->getMetaData().getDeliverTime());
+    // add before inserting so that the event is never filtered once found
+    filter.add(event->getId());
+    buffer->insert(event);
+}
+
+rsb::EventPtr BloomFilteredBuffer::get(const rsb::EventId &id) {
+    if (!filter.mightContain(id)) {
+        RSCTRACE(logger, "Filtered request for unknown event " << id);
+        ++filteredMisses;
+        return rsb::EventPtr();
+    }
+    rsb::EventPtr event = buffer->get(id);
+    if (!event) {
+        ++unfilteredMisses;
+    }
+    return event;
+}
+
+void BloomFilteredBuffer::removeOld(const boost::uint64_t &now) {
+    filter.advance(now);
+    buffer->removeOld(now);
+}
+
+void BloomFilteredBuffer::getRange(const rsb::Scope &scope,
+        const boost::uint64_t &start, const boost::uint64_t &end,
+        vector<rsb::EventPtr> &events) {
+    buffer->getRange(scope, start, end, events);
+}
+
+size_t BloomFilteredBuffer::size() {
+    return buffer->size();
+}
+
+boost::uint64_t BloomFilteredBuffer::getFilteredMisses() const {
+    return filteredMisses;
+}
+
+boost::uint64_t BloomFilteredBuffer::getUnfilteredMisses() const {
+    return unfilteredMisses;
+}
+
+}
+}
+}
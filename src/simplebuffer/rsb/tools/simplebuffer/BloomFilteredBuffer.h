@@ -0,0 +1,104 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+
+#include <rsc/logging/Logger.h>
+
+#include "Buffer.h"
+#include "RotatingBloomFilter.h"
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * A decorator which answers #get requests for events that were never
+ * inserted or have expired long ago without accessing the decorated buffer.
+ * The IDs of inserted events are remembered in a RotatingBloomFilter, which
+ * is consulted without locking before each lookup.
+ *
+ * Some misses still reach the decorated buffer, namely false positives of the
+ * filter and events which expired less than the retention time ago.
+ */
+class BloomFilteredBuffer: public Buffer {
+public:
+
+    /**
+     * Creates a new decorator.
+     *
+     * @param buffer the buffer to store events in
+     * @param deltaInMuSec the longest time the decorated buffer retains
+     *                     events after their delivery
+     * @param expectedEvents number of events expected to be inserted within
+     *                       half of @a deltaInMuSec
+     */
+    BloomFilteredBuffer(BufferPtr buffer, const boost::uint64_t &deltaInMuSec,
+            const std::size_t &expectedEvents);
+    virtual ~BloomFilteredBuffer();
+
+    void insert(rsb::EventPtr event);
+    rsb::EventPtr get(const rsb::EventId &id);
+    void removeOld(const boost::uint64_t &now);
+    void getRange(const rsb::Scope &scope, const boost::uint64_t &start,
+            const boost::uint64_t &end, std::vector<rsb::EventPtr> &events);
+    std::size_t size();
+
+    /**
+     * Returns the number of #get requests which were answered by the filter.
+     *
+     * @return filtered misses since creation
+     */
+    boost::uint64_t getFilteredMisses() const;
+
+    /**
+     * Returns the number of #get requests which passed the filter but were
+     * not found in the decorated buffer.
+     *
+     * @return unfiltered misses since creation
+     */
+    boost::uint64_t getUnfilteredMisses() const;
+
+private:
+
+    rsc::logging::LoggerPtr logger;
+
+    BufferPtr buffer;
+    RotatingBloomFilter filter;
+
+    boost::atomic<boost::uint64_t> filteredMisses;
+    boost::atomic<boost::uint64_t> unfilteredMisses;
+
+};
+
+typedef boost::shared_ptr<BloomFilteredBuffer> BloomFilteredBufferPtr;
+
+}
+}
+}
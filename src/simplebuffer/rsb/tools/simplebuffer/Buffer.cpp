@@ -26,6 +26,8 @@
 
 #include "Buffer.h"
 
+#include <rsb/MetaData.h>
+
 namespace rsb {
 namespace tools {
 namespace simplebuffer {
@@ -36,6 +38,16 @@ Buffer::Buffer() {
 Buffer::~Buffer() {
 }
 
+bool Buffer::isInRange(rsb::EventPtr event, const rsb::Scope &scope,
+        const boost::uint64_t &start, const boost::uint64_t &end) {
+    boost::uint64_t deliverTime = event->getMetaData().getDeliverTime();
+    if (deliverTime < start || deliverTime > end) {
+        return false;
+    }
+    rsb::ScopePtr eventScope = event->getScopePtr();
+    return *eventScope == scope || scope.isSuperScopeOf(*eventScope);
+}
+
 }
 }
 }
@@ -26,15 +26,25 @@
 
 #pragma once
 
+#include <boost/cstdint.hpp>
+#include <vector>
+
 #include <boost/shared_ptr.hpp>
 
 #include <rsb/Event.h>
+#include <rsb/Scope.h>
 
 namespace rsb {
 namespace tools {
 namespace simplebuffer {
 
 /**
+ * Stores events for later retrieval. Implementations hand out the inserted
+ * events and their payloads by reference, so that payloads received by a
+ * listener are passed on to RPC replies without being copied. Only buffers
+ * which keep events in a different representation, e.g. compressed or on
+ * disk, create new events when they are requested.
+ *
  * @author jwienke
  */
 class Buffer {
@@ -45,6 +55,44 @@ public:
     virtual void insert(rsb::EventPtr event) = 0;
     virtual rsb::EventPtr get(const rsb::EventId &id) = 0;
 
+    /**
+     * Removes all events whose retention time has passed. Implementations
+     * may expire events on insertion, but this method allows to release
+     * memory also when no new events arrive.
+     *
+     * @param now current time in microseconds since the epoch
+     */
+    virtual void removeOld(const boost::uint64_t &now) = 0;
+
+    /**
+     * Collects all events on a scope or one of its sub-scopes which were
+     * delivered in the given interval.
+     *
+     * @param scope scope of the requested events
+     * @param start earliest deliver time in microseconds, inclusive
+     * @param end latest deliver time in microseconds, inclusive
+     * @param events output parameter the events are appended to, ordered by
+     *               their deliver time
+     */
+    virtual void getRange(const rsb::Scope &scope,
+            const boost::uint64_t &start, const boost::uint64_t &end,
+            std::vector<rsb::EventPtr> &events) = 0;
+
+    /**
+     * Returns the number of events currently stored in the buffer.
+     *
+     * @return number of stored events
+     */
+    virtual std::size_t size() = 0;
+
+protected:
+
+    /**
+     * Tells whether an event is part of a range request.
+     */
+    static bool isInRange(rsb::EventPtr event, const rsb::Scope &scope,
+            const boost::uint64_t &start, const boost::uint64_t &end);
+
 };
 
 typedef boost::shared_ptr<Buffer> BufferPtr;
@@ -0,0 +1,172 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "CoalescingGetHandler.h"
+
+#include <stdexcept>
+
+#include <boost/bind.hpp>
+
+#include <rsc/runtime/TypeStringTools.h>
+
+using namespace std;
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+CoalescingGetHandler::CoalescingGetHandler(BufferPtr buffer,
+        rsb::InformerBasePtr informer, const unsigned int &numWorkers,
+        const size_t &maxQueuedRequests) :
+        rsb::Handler("REQUEST"), logger(
+                rsc::logging::Logger::getLogger(
+                        "rsbbuffer.CoalescingGetHandler")), buffer(buffer), informer(
+                informer), maxQueuedRequests(maxQueuedRequests), stopping(
+                false), coalescedRequests(0) {
+    if (numWorkers == 0) {
+        throw invalid_argument("At least one worker is required.");
+    }
+    if (maxQueuedRequests == 0) {
+        throw invalid_argument("At least one request has to be queued.");
+    }
+    for (unsigned int i = 0; i < numWorkers; ++i) {
+        workers.create_thread(boost::bind(&CoalescingGetHandler::work, this));
+    }
+}
+
+CoalescingGetHandler::~CoalescingGetHandler() {
+    {
+        boost::mutex::scoped_lock lock(mutex);
+        stopping = true;
+    }
+    requestQueued.notify_all();
+    workers.join_all();
+}
+
+void CoalescingGetHandler::handle(rsb::EventPtr request) {
+
+    if (request->getType() != rsc::runtime::typeName<rsb::EventId>()) {
+        RSCWARN(logger, "Ignoring request with unexpected type " << request);
+        return;
+    }
+    boost::shared_ptr<rsb::EventId> id = boost::static_pointer_cast<
+            rsb::EventId>(request->getData());
+
+    boost::mutex::scoped_lock lock(mutex);
+
+    map<rsb::EventId, vector<rsb::EventPtr> >::iterator waiting = pending.find(
+            *id);
+    if (waiting != pending.end()) {
+        waiting->second.push_back(request);
+        ++coalescedRequests;
+        return;
+    }
+
+    while (queue.size() >= maxQueuedRequests) {
+        requestTaken.wait(lock);
+    }
+    // a concurrent request may have been queued meanwhile
+    waiting = pending.find(*id);
+    if (waiting != pending.end()) {
+        waiting->second.push_back(request);
+        ++coalescedRequests;
+        return;
+    }
+
+    pending[*id].push_back(request);
+    queue.push_back(id);
+    requestQueued.notify_one();
+
+}
+
+boost::uint64_t CoalescingGetHandler::getCoalescedRequests() const {
+    return coalescedRequests;
+}
+
+void CoalescingGetHandler::publishReply(rsb::EventPtr reply) {
+    informer->publish(reply);
+}
+
+void CoalescingGetHandler::work() {
+
+    while (true) {
+
+        boost::shared_ptr<rsb::EventId> id;
+        vector<rsb::EventPtr> requests;
+        {
+            boost::mutex::scoped_lock lock(mutex);
+            while (queue.empty() && !stopping) {
+                requestQueued.wait(lock);
+            }
+            if (queue.empty()) {
+                return;
+            }
+            id = queue.front();
+            queue.pop_front();
+            // requests arriving from now on need a new lookup, as the event
+            // may be inserted while this one is in progress
+            pending[*id].swap(requests);
+            pending.erase(*id);
+        }
+        requestTaken.notify_one();
+
+        rsb::EventPtr event = buffer->get(*id);
+
+        for (vector<rsb::EventPtr>::const_iterator it = requests.begin();
+                it != requests.end(); ++it) {
+            answer(*it, event);
+        }
+
+    }
+
+}
+
+void CoalescingGetHandler::answer(rsb::EventPtr request, rsb::EventPtr event) {
+
+    rsb::EventPtr reply(new rsb::Event);
+    reply->setScope(*request->getScopePtr());
+    reply->setMethod("REPLY");
+    reply->addCause(request->getId());
+    if (event) {
+        reply->setType(event->getType());
+        reply->setData(event->getData());
+    } else {
+        reply->setType(rsc::runtime::typeName(typeid(void)));
+        reply->setData(boost::shared_ptr<void>());
+    }
+
+    try {
+        publishReply(reply);
+    } catch (const exception &e) {
+        RSCERROR(logger,
+                "Could not send reply to " << request->getId() << ": " << e.what());
+    }
+
+}
+
+}
+}
+}
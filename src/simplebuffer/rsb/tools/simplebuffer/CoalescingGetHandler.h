@@ -0,0 +1,140 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <deque>
+#include <map>
+#include <vector>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/thread.hpp>
+
+#include <rsc/logging/Logger.h>
+
+#include <rsb/EventId.h>
+#include <rsb/Handler.h>
+#include <rsb/Informer.h>
+
+#include "Buffer.h"
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * Answers requests of the @c get method of a LocalServer on a pool of worker
+ * threads instead of the thread dispatching the requests. This handler has to
+ * be added to a listener on the scope of the method and replaces the
+ * callback registered at the server. Replies follow the protocol of
+ * LocalServer, i.e. they are sent on the method scope with method @c REPLY
+ * and the request as their cause.
+ *
+ * Concurrent requests for the same EventId are coalesced as long as the
+ * lookup for the first one waits for a worker, so that the buffer is queried
+ * only once and the result is sent to all requesters. At most
+ * @a maxQueuedRequests distinct lookups wait for a worker. Further requests
+ * block the dispatching thread until a lookup has been started.
+ */
+class CoalescingGetHandler: public rsb::Handler {
+public:
+
+    /**
+     * Creates a new handler and starts its workers.
+     *
+     * @param buffer buffer to look up requested events in
+     * @param informer informer on the scope of the method to send replies
+     *                 with. Has to pass payloads through unconverted.
+     * @param numWorkers number of threads answering requests
+     * @param maxQueuedRequests number of distinct lookups which may wait for
+     *                          a worker
+     */
+    CoalescingGetHandler(BufferPtr buffer, rsb::InformerBasePtr informer,
+            const unsigned int &numWorkers,
+            const std::size_t &maxQueuedRequests = 1024);
+
+    /**
+     * Stops the workers after they have answered all queued requests.
+     */
+    virtual ~CoalescingGetHandler();
+
+    void handle(rsb::EventPtr request);
+
+    /**
+     * Returns the number of requests which were answered with the result of
+     * a lookup for an earlier request.
+     *
+     * @return coalesced requests since creation
+     */
+    boost::uint64_t getCoalescedRequests() const;
+
+protected:
+
+    /**
+     * Sends a reply to a request.
+     *
+     * @param reply the reply event
+     */
+    virtual void publishReply(rsb::EventPtr reply);
+
+private:
+
+    void work();
+    void answer(rsb::EventPtr request, rsb::EventPtr event);
+
+    rsc::logging::LoggerPtr logger;
+
+    BufferPtr buffer;
+    rsb::InformerBasePtr informer;
+    std::size_t maxQueuedRequests;
+
+    boost::mutex mutex;
+    boost::condition_variable requestQueued;
+    boost::condition_variable requestTaken;
+    bool stopping;
+
+    /**
+     * Ids to look up in request order. Each id is contained at most once.
+     */
+    std::deque<boost::shared_ptr<rsb::EventId> > queue;
+
+    /**
+     * Requests waiting for the lookup of a queued id. A worker takes the
+     * requests together with the id, so that later requests for the id queue
+     * a new lookup instead of missing an event inserted meanwhile.
+     */
+    std::map<rsb::EventId, std::vector<rsb::EventPtr> > pending;
+
+    boost::atomic<boost::uint64_t> coalescedRequests;
+
+    boost::thread_group workers;
+
+};
+
+}
+}
+}
@@ -0,0 +1,373 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "ConcurrentReadBuffer.h"
+
+#include <algorithm>
+#include <new>
+
+#include <boost/functional/hash.hpp>
+
+#include <rsb/EventId.h>
+#include <rsb/MetaData.h>
+
+using namespace std;
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+namespace {
+
+size_t nextPowerOfTwo(const size_t &value) {
+    size_t result = 2;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+bool deliveredBefore(rsb::EventPtr a, rsb::EventPtr b) {
+    return a->getMetaData().getDeliverTime()
+            < b->getMetaData().getDeliverTime();
+}
+
+}
+
+ConcurrentReadBuffer::Entry ConcurrentReadBuffer::TOMBSTONE;
+
+boost::atomic<boost::uint64_t> ConcurrentReadBuffer::nextId(0);
+
+boost::thread_specific_ptr<ConcurrentReadBuffer::ReaderRecordMap>
+        ConcurrentReadBuffer::localReaders;
+
+bool ConcurrentReadBuffer::Key::operator==(const Key &other) const {
+    return sequenceNumber == other.sequenceNumber
+            && participantId == other.participantId;
+}
+
+ConcurrentReadBuffer::Table::Table(const size_t &capacity) :
+        mask(capacity - 1), slots(new boost::atomic<Entry*>[capacity]) {
+    for (size_t i = 0; i < capacity; ++i) {
+        slots[i].store(0, boost::memory_order_relaxed);
+    }
+}
+
+ConcurrentReadBuffer::Table::~Table() {
+    delete[] slots;
+}
+
+ConcurrentReadBuffer::ReaderRecord::ReaderRecord() :
+        epoch(0), next(0) {
+}
+
+ConcurrentReadBuffer::ConcurrentReadBuffer(const boost::uint64_t &deltaInMuSec,
+        const size_t &initialCapacity) :
+        logger(
+                rsc::logging::Logger::getLogger(
+                        "rsbbuffer.ConcurrentReadBuffer")), id(nextId++), deltaInMuSec(
+                deltaInMuSec), minCapacity(nextPowerOfTwo(initialCapacity)), table(
+                new Table(minCapacity)), globalEpoch(1), readers(0), entryPool(
+                sizeof(Entry)), tombstones(0), latestDeletionTime(0) {
+}
+
+ConcurrentReadBuffer::~ConcurrentReadBuffer() {
+    for (deque<Entry*>::iterator it = entries.begin(); it != entries.end();
+            ++it) {
+        destroyEntry(*it);
+    }
+    for (vector<pair<boost::uint64_t, Entry*> >::iterator it =
+            retiredEntries.begin(); it != retiredEntries.end(); ++it) {
+        destroyEntry(it->second);
+    }
+    for (vector<pair<boost::uint64_t, Table*> >::iterator it =
+            retiredTables.begin(); it != retiredTables.end(); ++it) {
+        delete it->second;
+    }
+    delete table.load();
+    ReaderRecord *record = readers.load();
+    while (record) {
+        ReaderRecord *next = record->next;
+        delete record;
+        record = next;
+    }
+}
+
+ConcurrentReadBuffer::Key ConcurrentReadBuffer::makeKey(const rsb::EventId &id) {
+    Key key;
+    key.participantId = id.getParticipantId().getId();
+    key.sequenceNumber = id.getSequenceNumber();
+    return key;
+}
+
+size_t ConcurrentReadBuffer::hashKey(const Key &key) {
+    size_t hash = boost::uuids::hash_value(key.participantId);
+    boost::hash_combine(hash, key.sequenceNumber);
+    return hash;
+}
+
+ConcurrentReadBuffer::Entry *ConcurrentReadBuffer::find(const Table *table,
+        const Key &key, const size_t &hash) {
+    size_t slot = hash & table->mask;
+    for (size_t probes = 0; probes <= table->mask; ++probes) {
+        Entry *entry = table->slots[slot].load(boost::memory_order_acquire);
+        if (!entry) {
+            break;
+        }
+        if (entry != &TOMBSTONE && entry->hash == hash && entry->key == key) {
+            return entry;
+        }
+        slot = (slot + 1) & table->mask;
+    }
+    return 0;
+}
+
+ConcurrentReadBuffer::ReaderRecord *ConcurrentReadBuffer::readerRecord() {
+    ReaderRecordMap *records = localReaders.get();
+    if (!records) {
+        records = new ReaderRecordMap;
+        localReaders.reset(records);
+    }
+    ReaderRecord *&record = (*records)[id];
+    if (!record) {
+        record = new ReaderRecord;
+        ReaderRecord *head = readers.load();
+        do {
+            record->next = head;
+        } while (!readers.compare_exchange_weak(head, record));
+    }
+    return record;
+}
+
+rsb::EventPtr ConcurrentReadBuffer::get(const rsb::EventId &id) {
+    Key key = makeKey(id);
+    size_t hash = hashKey(key);
+
+    // announcing the epoch has to be ordered before loading any pointer so
+    // that the writer either sees this reader or we do not see the retired
+    // objects anymore
+    ReaderRecord *record = readerRecord();
+    record->epoch.store(globalEpoch.load(), boost::memory_order_seq_cst);
+    boost::atomic_thread_fence(boost::memory_order_seq_cst);
+
+    rsb::EventPtr result;
+    Entry *entry = find(table.load(boost::memory_order_seq_cst), key, hash);
+    if (entry) {
+        result = entry->event;
+    }
+
+    record->epoch.store(0, boost::memory_order_release);
+    return result;
+}
+
+void ConcurrentReadBuffer::insert(rsb::EventPtr event) {
+    boost::mutex::scoped_lock lock(writerMutex);
+    RSCTRACE(logger, "Inserting event with ID " << event->getId());
+
+    latestDeletionTime = max(latestDeletionTime,
+            event->getMetaData().getDeliverTime() + deltaInMuSec);
+    removeExpired(latestDeletionTime - deltaInMuSec);
+
+    Entry *entry = createEntry();
+    entry->key = makeKey(event->getId());
+    entry->hash = hashKey(entry->key);
+    entry->deletionTime = latestDeletionTime;
+    entry->event = event;
+
+    Table *current = table.load(boost::memory_order_relaxed);
+    if (find(current, entry->key, entry->hash)) {
+        RSCDEBUG(logger,
+                "Ignoring duplicate event with ID " << event->getId());
+        destroyEntry(entry);
+        return;
+    }
+
+    // keep the table at most half full including tombstones so that probe
+    // sequences of readers stay short
+    if ((entries.size() + tombstones + 1) * 2 > current->mask + 1) {
+        rebuild();
+        current = table.load(boost::memory_order_relaxed);
+    }
+
+    size_t slot = entry->hash & current->mask;
+    while (true) {
+        Entry *occupant = current->slots[slot].load(
+                boost::memory_order_relaxed);
+        if (!occupant || occupant == &TOMBSTONE) {
+            if (occupant == &TOMBSTONE) {
+                --tombstones;
+            }
+            break;
+        }
+        slot = (slot + 1) & current->mask;
+    }
+    current->slots[slot].store(entry, boost::memory_order_release);
+    entries.push_back(entry);
+}
+
+void ConcurrentReadBuffer::getRange(const rsb::Scope &scope,
+        const boost::uint64_t &start, const boost::uint64_t &end,
+        vector<rsb::EventPtr> &events) {
+    boost::mutex::scoped_lock lock(writerMutex);
+
+    // deletion times are monotonic and no earlier than the deliver times,
+    // all entries before the first one not before start are out of range
+    size_t first = 0;
+    size_t count = entries.size();
+    while (count > 0) {
+        size_t step = count / 2;
+        if (entries[first + step]->deletionTime - deltaInMuSec < start) {
+            first += step + 1;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+
+    // deletion times only bound the deliver times from above, so an event
+    // delivered out of order may follow entries after the end of the range
+    size_t offset = events.size();
+    for (deque<Entry*>::const_iterator it = entries.begin() + first;
+            it != entries.end(); ++it) {
+        if (isInRange((*it)->event, scope, start, end)) {
+            events.push_back((*it)->event);
+        }
+    }
+    stable_sort(events.begin() + offset, events.end(), deliveredBefore);
+}
+
+size_t ConcurrentReadBuffer::size() {
+    boost::mutex::scoped_lock lock(writerMutex);
+    return entries.size();
+}
+
+void ConcurrentReadBuffer::removeOld(const boost::uint64_t &now) {
+    boost::mutex::scoped_lock lock(writerMutex);
+    removeExpired(now);
+}
+
+ConcurrentReadBuffer::Entry *ConcurrentReadBuffer::createEntry() {
+    return new (entryPool.allocate()) Entry;
+}
+
+void ConcurrentReadBuffer::destroyEntry(Entry *entry) {
+    entry->~Entry();
+    entryPool.deallocate(entry);
+}
+
+void ConcurrentReadBuffer::removeExpired(const boost::uint64_t &now) {
+
+    Table *current = table.load(boost::memory_order_relaxed);
+    boost::uint64_t epoch = globalEpoch.load();
+    bool retired = false;
+
+    while (!entries.empty() && entries.front()->deletionTime <= now) {
+        Entry *entry = entries.front();
+        entries.pop_front();
+
+        size_t slot = entry->hash & current->mask;
+        while (current->slots[slot].load(boost::memory_order_relaxed)
+                != entry) {
+            slot = (slot + 1) & current->mask;
+        }
+        current->slots[slot].store(&TOMBSTONE, boost::memory_order_seq_cst);
+        ++tombstones;
+
+        retiredEntries.push_back(make_pair(epoch, entry));
+        retired = true;
+    }
+
+    if (retired) {
+        globalEpoch.fetch_add(1);
+        reclaim();
+    }
+
+}
+
+void ConcurrentReadBuffer::rebuild() {
+
+    size_t capacity = max(minCapacity,
+            nextPowerOfTwo(4 * (entries.size() + 1)));
+    RSCDEBUG(logger,
+            "Rebuilding table with " << entries.size() << " entries and " << tombstones << " tombstones to capacity " << capacity);
+
+    Table *newTable = new Table(capacity);
+    for (deque<Entry*>::const_iterator it = entries.begin();
+            it != entries.end(); ++it) {
+        size_t slot = (*it)->hash & newTable->mask;
+        while (newTable->slots[slot].load(boost::memory_order_relaxed)) {
+            slot = (slot + 1) & newTable->mask;
+        }
+        newTable->slots[slot].store(*it, boost::memory_order_relaxed);
+    }
+
+    Table *oldTable = table.exchange(newTable, boost::memory_order_seq_cst);
+    tombstones = 0;
+
+    retiredTables.push_back(make_pair(globalEpoch.fetch_add(1), oldTable));
+    reclaim();
+
+}
+
+void ConcurrentReadBuffer::reclaim() {
+
+    // objects retired in an epoch before the oldest epoch any reader
+    // announced cannot be reached anymore
+    boost::atomic_thread_fence(boost::memory_order_seq_cst);
+    boost::uint64_t safeEpoch = globalEpoch.load();
+    for (ReaderRecord *record = readers.load(); record;
+            record = record->next) {
+        boost::uint64_t epoch = record->epoch.load();
+        if (epoch != 0) {
+            safeEpoch = min(safeEpoch, epoch);
+        }
+    }
+
+    size_t kept = 0;
+    for (size_t i = 0; i < retiredEntries.size(); ++i) {
+        if (retiredEntries[i].first < safeEpoch) {
+            destroyEntry(retiredEntries[i].second);
+        } else {
+            retiredEntries[kept++] = retiredEntries[i];
+        }
+    }
+    retiredEntries.resize(kept);
+
+    kept = 0;
+    for (size_t i = 0; i < retiredTables.size(); ++i) {
+        if (retiredTables[i].first < safeEpoch) {
+            delete retiredTables[i].second;
+        } else {
+            retiredTables[kept++] = retiredTables[i];
+        }
+    }
+    retiredTables.resize(kept);
+
+}
+
+}
+}
+}
@@ -0,0 +1,197 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <deque>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/thread.hpp>
+#include <boost/uuid/uuid.hpp>
+
+#include <rsc/logging/Logger.h>
+
+#include "Buffer.h"
+#include "SlabPool.h"
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * A time bounded buffer whose lookups never block. Inserting threads are
+ * serialized by a mutex, but #get only performs atomic loads on an
+ * open-addressing hash table and is wait-free once the calling thread has
+ * registered itself with the buffer on its first call.
+ *
+ * Expired entries and replaced tables are reclaimed using epochs: each reader
+ * announces the global epoch it started in and the writer only deletes
+ * objects retired in an epoch no active reader can still observe.
+ */
+class ConcurrentReadBuffer: public Buffer {
+public:
+
+    /**
+     * Creates a new buffer.
+     *
+     * @param deltaInMuSec time to retain events after their delivery
+     * @param initialCapacity number of slots of the initial hash table.
+     *                        Rounded up to the next power of two.
+     */
+    ConcurrentReadBuffer(const boost::uint64_t &deltaInMuSec,
+            const std::size_t &initialCapacity = 2048);
+    virtual ~ConcurrentReadBuffer();
+
+    void insert(rsb::EventPtr event);
+    rsb::EventPtr get(const rsb::EventId &id);
+    void removeOld(const boost::uint64_t &now);
+
+    /**
+     * Range requests are not wait-free and contend with inserts.
+     */
+    void getRange(const rsb::Scope &scope, const boost::uint64_t &start,
+            const boost::uint64_t &end, std::vector<rsb::EventPtr> &events);
+
+    /**
+     * Returns the number of events currently stored in the buffer.
+     *
+     * @return number of stored events
+     */
+    std::size_t size();
+
+private:
+
+    struct Key {
+        boost::uuids::uuid participantId;
+        boost::uint32_t sequenceNumber;
+
+        bool operator==(const Key &other) const;
+    };
+
+    /**
+     * Immutable once published in a table.
+     */
+    struct Entry {
+        Key key;
+        std::size_t hash;
+        boost::uint64_t deletionTime;
+        rsb::EventPtr event;
+    };
+
+    struct Table {
+        explicit Table(const std::size_t &capacity);
+        ~Table();
+
+        std::size_t mask;
+        boost::atomic<Entry*> *slots;
+    };
+
+    /**
+     * Announces the epoch a reader thread is currently operating in or 0 if
+     * the thread is not reading.
+     */
+    struct ReaderRecord {
+        ReaderRecord();
+
+        boost::atomic<boost::uint64_t> epoch;
+        ReaderRecord *next;
+    };
+
+    static Entry TOMBSTONE;
+
+    static Key makeKey(const rsb::EventId &id);
+    static std::size_t hashKey(const Key &key);
+
+    /**
+     * Looks up the entry for a key in a table without taking any lock.
+     */
+    static Entry *find(const Table *table, const Key &key,
+            const std::size_t &hash);
+
+    typedef std::map<boost::uint64_t, ReaderRecord*> ReaderRecordMap;
+
+    /**
+     * Source of the ids of buffer instances, which are never reused.
+     */
+    static boost::atomic<boost::uint64_t> nextId;
+
+    /**
+     * Records of the calling thread by the id of the buffer they are
+     * registered with. Records are owned by the buffer and stay registered
+     * after their thread exits. Entries of destroyed buffers stay in the map
+     * but are never looked up again because their id is not reused.
+     */
+    static boost::thread_specific_ptr<ReaderRecordMap> localReaders;
+
+    ReaderRecord *readerRecord();
+
+    Entry *createEntry();
+    void destroyEntry(Entry *entry);
+
+    void removeExpired(const boost::uint64_t &now);
+    void rebuild();
+    void reclaim();
+
+    rsc::logging::LoggerPtr logger;
+
+    boost::uint64_t id;
+    boost::uint64_t deltaInMuSec;
+    std::size_t minCapacity;
+
+    boost::atomic<Table*> table;
+    boost::atomic<boost::uint64_t> globalEpoch;
+    boost::atomic<ReaderRecord*> readers;
+
+    /**
+     * Serializes all modifications. Members below are only accessed while
+     * holding it.
+     */
+    boost::mutex writerMutex;
+
+    /**
+     * Recycles the memory of reclaimed entries.
+     */
+    SlabPool entryPool;
+
+    /**
+     * Live entries in insertion order with monotonic deletion times.
+     */
+    std::deque<Entry*> entries;
+    std::size_t tombstones;
+    boost::uint64_t latestDeletionTime;
+
+    std::vector<std::pair<boost::uint64_t, Entry*> > retiredEntries;
+    std::vector<std::pair<boost::uint64_t, Table*> > retiredTables;
+
+};
+
+}
+}
+}
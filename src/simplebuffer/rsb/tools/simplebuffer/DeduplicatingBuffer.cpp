@@ -0,0 +1,163 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "DeduplicatingBuffer.h"
+
+using namespace std;
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+DeduplicatingBuffer::DeduplicatingBuffer(BufferPtr buffer,
+        const size_t &minBytes) :
+        logger(rsc::logging::Logger::getLogger("rsbbuffer.DeduplicatingBuffer")), buffer(
+                buffer), minBytes(minBytes), insertedBytes(0), copiedBytes(0) {
+}
+
+DeduplicatingBuffer::~DeduplicatingBuffer() {
+}
+
+boost::uint64_t DeduplicatingBuffer::hashPayload(
+        const SerializedPayload &payload) {
+    // FNV-1a over schema and bytes, separated to distinguish their borders
+    boost::uint64_t hash = UINT64_C(14695981039346656037);
+    for (string::const_iterator it = payload.first.begin();
+            it != payload.first.end(); ++it) {
+        hash = (hash ^ static_cast<unsigned char>(*it))
+                * UINT64_C(1099511628211);
+    }
+    hash = hash * UINT64_C(1099511628211);
+    for (string::const_iterator it = payload.second.begin();
+            it != payload.second.end(); ++it) {
+        hash = (hash ^ static_cast<unsigned char>(*it))
+                * UINT64_C(1099511628211);
+    }
+    return hash;
+}
+
+void DeduplicatingBuffer::insert(rsb::EventPtr event) {
+
+    SerializedPayloadPtr payload = getSerializedPayload(event);
+    size_t bytes = getSerializedPayloadSize(event);
+    if (!payload || bytes < minBytes) {
+        buffer->insert(event);
+        return;
+    }
+
+    // hash outside the lock, it is the expensive part
+    boost::uint64_t hash = hashPayload(*payload);
+    insertedBytes += bytes;
+
+    {
+        boost::mutex::scoped_lock lock(mutex);
+        pair<PayloadMap::iterator, PayloadMap::iterator> candidates =
+                payloads.equal_range(hash);
+        SerializedPayloadPtr shared;
+        for (PayloadMap::iterator it = candidates.first;
+                it != candidates.second && !shared;) {
+            SerializedPayloadPtr candidate = it->second.lock();
+            if (!candidate) {
+                payloads.erase(it++);
+            } else if (*candidate == *payload) {
+                shared = candidate;
+            } else {
+                ++it;
+            }
+        }
+        if (shared) {
+            // other handlers receive the same event, hence store a copy
+            rsb::EventPtr copy(new rsb::Event(*event));
+            copy->setData(shared);
+            event = copy;
+        } else {
+            payloads.insert(make_pair(hash, payload));
+            copiedBytes += bytes;
+        }
+    }
+
+    buffer->insert(event);
+
+}
+
+rsb::EventPtr DeduplicatingBuffer::get(const rsb::EventId &id) {
+    return buffer->get(id);
+}
+
+void DeduplicatingBuffer::removeOld(const boost::uint64_t &now) {
+    buffer->removeOld(now);
+
+    boost::mutex::scoped_lock lock(mutex);
+    for (PayloadMap::iterator it = payloads.begin(); it != payloads.end();) {
+        if (it->second.expired()) {
+            payloads.erase(it++);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void DeduplicatingBuffer::getRange(const rsb::Scope &scope,
+        const boost::uint64_t &start, const boost::uint64_t &end,
+        vector<rsb::EventPtr> &events) {
+    buffer->getRange(scope, start, end, events);
+}
+
+size_t DeduplicatingBuffer::size() {
+    return buffer->size();
+}
+
+boost::uint64_t DeduplicatingBuffer::getInsertedBytes() const {
+    return insertedBytes;
+}
+
+boost::uint64_t DeduplicatingBuffer::getCopiedBytes() const {
+    return copiedBytes;
+}
+
+double DeduplicatingBuffer::getDeduplicationRatio() const {
+    boost::uint64_t copied = copiedBytes;
+    if (copied == 0) {
+        return 1.0;
+    }
+    return double(insertedBytes) / double(copied);
+}
+
+size_t DeduplicatingBuffer::getSharedPayloads() {
+    boost::mutex::scoped_lock lock(mutex);
+    size_t count = 0;
+    for (PayloadMap::const_iterator it = payloads.begin();
+            it != payloads.end(); ++it) {
+        if (!it->second.expired()) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+}
+}
+}
@@ -0,0 +1,133 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <map>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/thread.hpp>
+#include <boost/weak_ptr.hpp>
+
+#include <rsc/logging/Logger.h>
+
+#include "Buffer.h"
+#include "SerializedPayload.h"
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * A decorator which lets stored events with identical SerializedPayloads
+ * share a single copy of it. Payloads are hashed on insertion. If a still
+ * referenced payload with the same wire schema and bytes exists, a copy of
+ * the event using that payload is stored instead. The shared payload is released once the last event using it has
+ * been removed from the decorated buffer.
+ *
+ * Byte limits of the decorated buffer still account each event with the
+ * full size of its payload.
+ */
+class DeduplicatingBuffer: public Buffer {
+public:
+
+    /**
+     * Creates a new decorator.
+     *
+     * @param buffer the buffer to store events in
+     * @param minBytes payloads smaller than this are stored as they are
+     */
+    DeduplicatingBuffer(BufferPtr buffer, const std::size_t &minBytes = 64);
+    virtual ~DeduplicatingBuffer();
+
+    void insert(rsb::EventPtr event);
+    rsb::EventPtr get(const rsb::EventId &id);
+
+    /**
+     * Also forgets payloads which are not used by any stored event anymore.
+     */
+    void removeOld(const boost::uint64_t &now);
+
+    void getRange(const rsb::Scope &scope, const boost::uint64_t &start,
+            const boost::uint64_t &end, std::vector<rsb::EventPtr> &events);
+    std::size_t size();
+
+    /**
+     * Returns the payload bytes of all events considered for deduplication.
+     *
+     * @return bytes since creation
+     */
+    boost::uint64_t getInsertedBytes() const;
+
+    /**
+     * Returns the payload bytes which were not found in a shared payload and
+     * thus had to be stored.
+     *
+     * @return bytes since creation
+     */
+    boost::uint64_t getCopiedBytes() const;
+
+    /**
+     * Returns the ratio of inserted to copied payload bytes, e.g. 10 if only
+     * every tenth payload had to be stored.
+     *
+     * @return ratio since creation or 1 if nothing was inserted
+     */
+    double getDeduplicationRatio() const;
+
+    /**
+     * Returns the number of distinct payloads currently used by stored
+     * events.
+     *
+     * @return number of distinct payloads
+     */
+    std::size_t getSharedPayloads();
+
+private:
+
+    typedef std::multimap<boost::uint64_t, boost::weak_ptr<SerializedPayload> > PayloadMap;
+
+    static boost::uint64_t hashPayload(const SerializedPayload &payload);
+
+    rsc::logging::LoggerPtr logger;
+
+    BufferPtr buffer;
+    std::size_t minBytes;
+
+    boost::mutex mutex;
+    PayloadMap payloads;
+
+    boost::atomic<boost::uint64_t> insertedBytes;
+    boost::atomic<boost::uint64_t> copiedBytes;
+
+};
+
+typedef boost::shared_ptr<DeduplicatingBuffer> DeduplicatingBufferPtr;
+
+}
+}
+}
@@ -0,0 +1,100 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "EventIdListConverter.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <boost/uuid/uuid.hpp>
+
+#include <rsc/runtime/TypeStringTools.h>
+
+#include <rsb/converter/SerializationException.h>
+
+#include "BinaryEncoding.h"
+
+using namespace std;
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+const string EventIdListConverter::WIRE_SCHEMA = "rsb-buffer-event-id-list";
+
+EventIdListConverter::EventIdListConverter() :
+        rsb::converter::Converter<string>(
+                rsc::runtime::typeName<EventIdList>(), WIRE_SCHEMA, true) {
+}
+
+EventIdListConverter::~EventIdListConverter() {
+}
+
+string EventIdListConverter::serialize(const rsb::AnnotatedData &data,
+        string &wire) {
+    assert(data.first == getDataType());
+
+    EventIdListPtr ids = boost::static_pointer_cast<EventIdList>(data.second);
+    wire.clear();
+    wire.reserve(ids->size() * (boost::uuids::uuid::static_size() + 4));
+    for (EventIdList::const_iterator it = ids->begin(); it != ids->end();
+            ++it) {
+        boost::uuids::uuid participant = it->getParticipantId().getId();
+        wire.append(participant.begin(), participant.end());
+        writeUint32(wire, it->getSequenceNumber());
+    }
+    return getWireSchema();
+}
+
+rsb::AnnotatedData EventIdListConverter::deserialize(
+        const string &wireSchema, const string &wire) {
+    assert(wireSchema == getWireSchema());
+
+    const size_t idSize = boost::uuids::uuid::static_size() + 4;
+    if (wire.size() % idSize != 0) {
+        throw rsb::converter::SerializationException(
+                "Invalid event id list length.");
+    }
+
+    EventIdListPtr ids(new EventIdList);
+    ids->reserve(wire.size() / idSize);
+    size_t offset = 0;
+    while (offset < wire.size()) {
+        boost::uint8_t participant[16];
+        copy(wire.begin() + offset,
+                wire.begin() + offset + boost::uuids::uuid::static_size(),
+                participant);
+        offset += boost::uuids::uuid::static_size();
+        boost::uint32_t sequenceNumber = readUint32(wire, offset);
+        ids->push_back(
+                rsb::EventId(rsc::misc::UUID(participant), sequenceNumber));
+    }
+    return make_pair(getDataType(), ids);
+}
+
+}
+}
+}
@@ -0,0 +1,67 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include <rsb/EventId.h>
+#include <rsb/converter/Converter.h>
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * Request type of the @c getMany method of the buffer.
+ */
+typedef std::vector<rsb::EventId> EventIdList;
+typedef boost::shared_ptr<EventIdList> EventIdListPtr;
+
+/**
+ * Converts EventIdList requests. Clients have to register this converter to
+ * call the @c getMany method.
+ */
+class EventIdListConverter: public rsb::converter::Converter<std::string> {
+public:
+
+    EventIdListConverter();
+    virtual ~EventIdListConverter();
+
+    std::string serialize(const rsb::AnnotatedData &data, std::string &wire);
+    rsb::AnnotatedData deserialize(const std::string &wireSchema,
+            const std::string &wire);
+
+    static const std::string WIRE_SCHEMA;
+
+};
+
+}
+}
+}
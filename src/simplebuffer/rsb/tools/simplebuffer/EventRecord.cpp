@@ -0,0 +1,160 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "EventRecord.h"
+
+#include <algorithm>
+#include <set>
+#include <stdexcept>
+
+#include <boost/uuid/uuid.hpp>
+
+#include <rsc/runtime/TypeStringTools.h>
+
+#include <rsb/EventId.h>
+#include <rsb/MetaData.h>
+
+#include "BinaryEncoding.h"
+#include "SerializedPayload.h"
+
+using namespace std;
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+namespace {
+
+void writeEventId(string &record, const rsb::EventId &id) {
+    boost::uuids::uuid participant = id.getParticipantId().getId();
+    record.append(participant.begin(), participant.end());
+    writeUint32(record, id.getSequenceNumber());
+}
+
+rsb::EventId readEventId(const char *data, const size_t &size,
+        size_t &offset) {
+    if (offset > size
+            || size - offset < boost::uuids::uuid::static_size()) {
+        throw out_of_range("Not enough bytes to decode an event id.");
+    }
+    boost::uint8_t participant[16];
+    copy(data + offset, data + offset + boost::uuids::uuid::static_size(),
+            participant);
+    offset += boost::uuids::uuid::static_size();
+    boost::uint32_t sequenceNumber = readUint32(data, size, offset);
+    return rsb::EventId(rsc::misc::UUID(participant), sequenceNumber);
+}
+
+}
+
+void encodeEventRecord(rsb::EventPtr event, string &record) {
+
+    SerializedPayloadPtr payload = getSerializedPayload(event);
+    if (!payload) {
+        throw invalid_argument(
+                "Only events with unconverted payloads can be encoded.");
+    }
+
+    writeEventId(record, event->getId());
+    writeString(record, event->getScopePtr()->toString());
+    writeString(record, event->getMethod());
+    writeString(record, payload->first);
+    writeString(record, payload->second);
+
+    const rsb::MetaData &metaData = event->getMetaData();
+    writeUint64(record, metaData.getCreateTime());
+    writeUint64(record, metaData.getSendTime());
+    writeUint64(record, metaData.getReceiveTime());
+    writeUint64(record, metaData.getDeliverTime());
+
+    writeUint32(record,
+            distance(metaData.userTimesBegin(), metaData.userTimesEnd()));
+    for (map<string, boost::uint64_t>::const_iterator it =
+            metaData.userTimesBegin(); it != metaData.userTimesEnd(); ++it) {
+        writeString(record, it->first);
+        writeUint64(record, it->second);
+    }
+    writeUint32(record,
+            distance(metaData.userInfosBegin(), metaData.userInfosEnd()));
+    for (map<string, string>::const_iterator it = metaData.userInfosBegin();
+            it != metaData.userInfosEnd(); ++it) {
+        writeString(record, it->first);
+        writeString(record, it->second);
+    }
+
+    set<rsb::EventId> causes = event->getCauses();
+    writeUint32(record, causes.size());
+    for (set<rsb::EventId>::const_iterator it = causes.begin();
+            it != causes.end(); ++it) {
+        writeEventId(record, *it);
+    }
+
+}
+
+rsb::EventPtr decodeEventRecord(const char *data, const size_t &size) {
+
+    size_t offset = 0;
+    rsb::EventId id = readEventId(data, size, offset);
+    string scope = readString(data, size, offset);
+    string method = readString(data, size, offset);
+    SerializedPayloadPtr payload(new SerializedPayload);
+    payload->first = readString(data, size, offset);
+    payload->second = readString(data, size, offset);
+
+    static const string TYPE = rsc::runtime::typeName<SerializedPayload>();
+    rsb::EventPtr event(new rsb::Event(rsb::Scope(scope), payload, TYPE,
+            method));
+    event->setId(id.getParticipantId(), id.getSequenceNumber());
+
+    rsb::MetaData &metaData = event->mutableMetaData();
+    metaData.setCreateTime(readUint64(data, size, offset));
+    metaData.setSendTime(readUint64(data, size, offset));
+    metaData.setReceiveTime(readUint64(data, size, offset));
+    metaData.setDeliverTime(readUint64(data, size, offset));
+
+    boost::uint32_t userTimes = readUint32(data, size, offset);
+    for (boost::uint32_t i = 0; i < userTimes; ++i) {
+        string key = readString(data, size, offset);
+        metaData.setUserTime(key, readUint64(data, size, offset));
+    }
+    boost::uint32_t userInfos = readUint32(data, size, offset);
+    for (boost::uint32_t i = 0; i < userInfos; ++i) {
+        string key = readString(data, size, offset);
+        metaData.setUserInfo(key, readString(data, size, offset));
+    }
+
+    boost::uint32_t causes = readUint32(data, size, offset);
+    for (boost::uint32_t i = 0; i < causes; ++i) {
+        event->addCause(readEventId(data, size, offset));
+    }
+
+    return event;
+
+}
+
+}
+}
+}
@@ -0,0 +1,61 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include <rsb/Event.h>
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * Encodes an event with a SerializedPayload including its id, scope, method,
+ * meta data and causes into a self-contained byte record, e.g. for storing
+ * it on disk.
+ *
+ * @param event the event to encode
+ * @param record the encoded event is appended here
+ * @throw std::invalid_argument the event does not carry a SerializedPayload
+ */
+void encodeEventRecord(rsb::EventPtr event, std::string &record);
+
+/**
+ * Decodes an event from a record created with #encodeEventRecord.
+ *
+ * @param data start of the record
+ * @param size number of bytes available at @a data
+ * @return the decoded event with a SerializedPayload
+ * @throw std::out_of_range the record is truncated
+ */
+rsb::EventPtr decodeEventRecord(const char *data, const std::size_t &size);
+
+}
+}
+}
@@ -0,0 +1,64 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <rsc/threading/PeriodicTask.h>
+
+#include "Buffer.h"
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * A task which periodically removes old events from a buffer. This keeps
+ * the time lookup out of the insertion path and releases memory even if no
+ * new events arrive.
+ */
+class ExpiryTask: public rsc::threading::PeriodicTask {
+public:
+
+    /**
+     * Creates a new task.
+     *
+     * @param buffer the buffer to expire events in
+     * @param periodMs interval between two expiry runs in milliseconds
+     */
+    ExpiryTask(BufferPtr buffer, const unsigned int &periodMs);
+    virtual ~ExpiryTask();
+
+    void execute();
+
+private:
+
+    BufferPtr buffer;
+
+};
+
+}
+}
+}
@@ -0,0 +1,123 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "InstrumentedBuffer.h"
+
+#include <rsc/misc/langutils.h>
+
+using namespace std;
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+InstrumentedBuffer::InstrumentedBuffer(BufferPtr buffer) :
+        buffer(buffer), inserts(0), expirations(0), hits(0), misses(0),
+        rangeRequests(0), rangeEvents(0) {
+}
+
+InstrumentedBuffer::~InstrumentedBuffer() {
+}
+
+void InstrumentedBuffer::insert(rsb::EventPtr event) {
+    boost::uint64_t start = rsc::misc::currentTimeMicros();
+    buffer->insert(event);
+    insertLatency.record(rsc::misc::currentTimeMicros() - start);
+    inserts.fetch_add(1, boost::memory_order_relaxed);
+}
+
+rsb::EventPtr InstrumentedBuffer::get(const rsb::EventId &id) {
+    boost::uint64_t start = rsc::misc::currentTimeMicros();
+    rsb::EventPtr event = buffer->get(id);
+    getLatency.record(rsc::misc::currentTimeMicros() - start);
+    if (event) {
+        hits.fetch_add(1, boost::memory_order_relaxed);
+    } else {
+        misses.fetch_add(1, boost::memory_order_relaxed);
+    }
+    return event;
+}
+
+void InstrumentedBuffer::removeOld(const boost::uint64_t &now) {
+    boost::uint64_t start = rsc::misc::currentTimeMicros();
+    size_t before = buffer->size();
+    buffer->removeOld(now);
+    size_t after = buffer->size();
+    expiryLatency.record(rsc::misc::currentTimeMicros() - start);
+    // concurrent inserts may let the buffer grow in the meantime
+    if (before > after) {
+        expirations.fetch_add(before - after, boost::memory_order_relaxed);
+    }
+}
+
+void InstrumentedBuffer::getRange(const rsb::Scope &scope,
+        const boost::uint64_t &start, const boost::uint64_t &end,
+        vector<rsb::EventPtr> &events) {
+    boost::uint64_t startTime = rsc::misc::currentTimeMicros();
+    size_t offset = events.size();
+    buffer->getRange(scope, start, end, events);
+    rangeLatency.record(rsc::misc::currentTimeMicros() - startTime);
+    rangeRequests.fetch_add(1, boost::memory_order_relaxed);
+    rangeEvents.fetch_add(events.size() - offset,
+            boost::memory_order_relaxed);
+}
+
+size_t InstrumentedBuffer::size() {
+    return buffer->size();
+}
+
+void InstrumentedBuffer::printStatistics(ostream &stream) {
+    size_t stored = size();
+    boost::uint64_t inserted = inserts.load(boost::memory_order_relaxed);
+    boost::uint64_t expired = expirations.load(boost::memory_order_relaxed);
+    boost::uint64_t evicted =
+            inserted > stored + expired ? inserted - stored - expired : 0;
+    stream << "stored=" << stored << " inserted=" << inserted << " expired="
+            << expired << " evicted=" << evicted << " hits="
+            << hits.load(boost::memory_order_relaxed) << " misses="
+            << misses.load(boost::memory_order_relaxed) << " ranges="
+            << rangeRequests.load(boost::memory_order_relaxed)
+            << " rangeEvents="
+            << rangeEvents.load(boost::memory_order_relaxed);
+    printLatency(stream, "insert", insertLatency);
+    printLatency(stream, "get", getLatency);
+    printLatency(stream, "range", rangeLatency);
+    printLatency(stream, "expiry", expiryLatency);
+}
+
+void InstrumentedBuffer::printLatency(ostream &stream, const string &name,
+        const LatencyHistogram &histogram) {
+    boost::uint64_t count = histogram.getCount();
+    stream << " " << name << ".mean="
+            << (count == 0 ? 0 : histogram.getTotal() / count) << " " << name
+            << ".p50=" << histogram.getQuantile(0.5) << " " << name
+            << ".p99=" << histogram.getQuantile(0.99) << " " << name
+            << ".p999=" << histogram.getQuantile(0.999);
+}
+
+}
+}
+}
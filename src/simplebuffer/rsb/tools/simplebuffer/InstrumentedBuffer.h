@@ -0,0 +1,101 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <ostream>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "Buffer.h"
+#include "LatencyHistogram.h"
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * A decorator which counts the operations on another buffer and records
+ * their latencies including the time spent waiting for locks. All counters
+ * are cumulative since creation and updated without locking.
+ */
+class InstrumentedBuffer: public Buffer {
+public:
+
+    /**
+     * Creates a new decorator.
+     *
+     * @param buffer the buffer to instrument
+     */
+    explicit InstrumentedBuffer(BufferPtr buffer);
+    virtual ~InstrumentedBuffer();
+
+    void insert(rsb::EventPtr event);
+    rsb::EventPtr get(const rsb::EventId &id);
+    void removeOld(const boost::uint64_t &now);
+    void getRange(const rsb::Scope &scope, const boost::uint64_t &start,
+            const boost::uint64_t &end, std::vector<rsb::EventPtr> &events);
+    std::size_t size();
+
+    /**
+     * Prints the current statistics as space separated key=value pairs.
+     * Latencies are given in microseconds. "expired" counts the events
+     * removed by removeOld. "evicted" counts all other inserted events which
+     * are not stored anymore, e.g. events expired by the decorated buffer on
+     * insertion, displaced by size limits or rejected as duplicates.
+     *
+     * @param stream the stream to print to
+     */
+    void printStatistics(std::ostream &stream);
+
+private:
+
+    static void printLatency(std::ostream &stream, const std::string &name,
+            const LatencyHistogram &histogram);
+
+    BufferPtr buffer;
+
+    boost::atomic<boost::uint64_t> inserts;
+    boost::atomic<boost::uint64_t> expirations;
+    boost::atomic<boost::uint64_t> hits;
+    boost::atomic<boost::uint64_t> misses;
+    boost::atomic<boost::uint64_t> rangeRequests;
+    boost::atomic<boost::uint64_t> rangeEvents;
+
+    LatencyHistogram insertLatency;
+    LatencyHistogram getLatency;
+    LatencyHistogram rangeLatency;
+    LatencyHistogram expiryLatency;
+
+};
+
+typedef boost::shared_ptr<InstrumentedBuffer> InstrumentedBufferPtr;
+
+}
+}
+}
@@ -0,0 +1,102 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "LatencyHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+const size_t LatencyHistogram::BUCKETS;
+
+LatencyHistogram::LatencyHistogram() :
+        total(0) {
+    for (size_t i = 0; i < BUCKETS; ++i) {
+        buckets[i].store(0, boost::memory_order_relaxed);
+    }
+}
+
+LatencyHistogram::~LatencyHistogram() {
+}
+
+size_t LatencyHistogram::bucketFor(const boost::uint64_t &micros) {
+    size_t bucket = 0;
+    for (boost::uint64_t remaining = micros; remaining != 0; remaining >>= 1) {
+        ++bucket;
+    }
+    return bucket < BUCKETS ? bucket : BUCKETS - 1;
+}
+
+void LatencyHistogram::record(const boost::uint64_t &micros) {
+    buckets[bucketFor(micros)].fetch_add(1, boost::memory_order_relaxed);
+    total.fetch_add(micros, boost::memory_order_relaxed);
+}
+
+boost::uint64_t LatencyHistogram::getCount() const {
+    boost::uint64_t count = 0;
+    for (size_t i = 0; i < BUCKETS; ++i) {
+        count += buckets[i].load(boost::memory_order_relaxed);
+    }
+    return count;
+}
+
+boost::uint64_t LatencyHistogram::getTotal() const {
+    return total.load(boost::memory_order_relaxed);
+}
+
+boost::uint64_t LatencyHistogram::getQuantile(const double &quantile) const {
+
+    boost::uint64_t counts[BUCKETS];
+    boost::uint64_t count = 0;
+    for (size_t i = 0; i < BUCKETS; ++i) {
+        counts[i] = buckets[i].load(boost::memory_order_relaxed);
+        count += counts[i];
+    }
+    if (count == 0) {
+        return 0;
+    }
+
+    boost::uint64_t rank = max(boost::uint64_t(1),
+            boost::uint64_t(ceil(quantile * count)));
+    boost::uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKETS; ++i) {
+        seen += counts[i];
+        if (seen >= rank) {
+            return i == 0 ? 0 : (boost::uint64_t(1) << i) - 1;
+        }
+    }
+    return (boost::uint64_t(1) << (BUCKETS - 1)) - 1;
+
+}
+
+}
+}
+}
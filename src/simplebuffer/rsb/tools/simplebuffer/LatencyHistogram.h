@@ -0,0 +1,97 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * A histogram of durations in microseconds with power of two buckets.
+ * Recording only increments two atomic counters and never blocks, so it can
+ * be used concurrently in hot paths. Counts are cumulative since creation.
+ */
+class LatencyHistogram: private boost::noncopyable {
+public:
+
+    /**
+     * Bucket 0 counts durations of 0, bucket i > 0 durations in
+     * [2^(i-1), 2^i). The last bucket also counts all longer durations.
+     */
+    static const std::size_t BUCKETS = 40;
+
+    LatencyHistogram();
+    virtual ~LatencyHistogram();
+
+    /**
+     * Records a single duration.
+     *
+     * @param micros duration in microseconds
+     */
+    void record(const boost::uint64_t &micros);
+
+    /**
+     * Returns the number of recorded durations.
+     *
+     * @return count of durations
+     */
+    boost::uint64_t getCount() const;
+
+    /**
+     * Returns the sum of all recorded durations.
+     *
+     * @return total duration in microseconds
+     */
+    boost::uint64_t getTotal() const;
+
+    /**
+     * Returns an upper bound for a quantile of the recorded durations.
+     *
+     * @param quantile requested quantile in [0, 1], e.g. 0.99
+     * @return upper limit of the bucket containing the quantile or 0 if
+     *         nothing was recorded
+     */
+    boost::uint64_t getQuantile(const double &quantile) const;
+
+private:
+
+    static std::size_t bucketFor(const boost::uint64_t &micros);
+
+    boost::atomic<boost::uint64_t> buckets[BUCKETS];
+    boost::atomic<boost::uint64_t> total;
+
+};
+
+}
+}
+}
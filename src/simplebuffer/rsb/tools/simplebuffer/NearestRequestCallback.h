@@ -0,0 +1,60 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <rsb/EventCollections.h>
+#include <rsb/patterns/LocalServer.h>
+
+#include "TimeIndexedBuffer.h"
+#include "TimePoint.h"
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * Answers TimePoint requests with the buffered event closest in time. The
+ * reply contains the event with its meta data or is empty if no event
+ * exists on the requested scope.
+ */
+class NearestRequestCallback: public rsb::patterns::LocalServer::Callback<
+        TimePoint, rsb::EventsByScopeMap> {
+public:
+    NearestRequestCallback(TimeIndexedBufferPtr buffer);
+    virtual ~NearestRequestCallback();
+
+    boost::shared_ptr<rsb::EventsByScopeMap> call(
+            const std::string &methodName, boost::shared_ptr<TimePoint> input);
+
+private:
+    TimeIndexedBufferPtr buffer;
+
+};
+
+}
+}
+}
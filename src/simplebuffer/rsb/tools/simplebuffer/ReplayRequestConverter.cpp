@@ -0,0 +1,87 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "ReplayRequestConverter.h"
+
+#include <stdexcept>
+
+#include <rsc/runtime/TypeStringTools.h>
+
+#include <rsb/converter/SerializationException.h>
+
+#include "BinaryEncoding.h"
+#include "ReplayRequest.h"
+
+using namespace std;
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+const string ReplayRequestConverter::WIRE_SCHEMA = "rsb-buffer-replay-request";
+
+ReplayRequestConverter::ReplayRequestConverter() :
+        rsb::converter::Converter<string>(
+                rsc::runtime::typeName<ReplayRequest>(), WIRE_SCHEMA, true) {
+}
+
+ReplayRequestConverter::~ReplayRequestConverter() {
+}
+
+string ReplayRequestConverter::serialize(const rsb::AnnotatedData &data,
+        string &wire) {
+    assert(data.first == getDataType());
+
+    boost::shared_ptr<ReplayRequest> request = boost::static_pointer_cast<
+            ReplayRequest>(data.second);
+    wire.clear();
+    writeUint64(wire, request->getStart());
+    writeString(wire, request->getScope().toString());
+    wire.append(request->getTarget().toString());
+    return getWireSchema();
+}
+
+rsb::AnnotatedData ReplayRequestConverter::deserialize(
+        const string &wireSchema, const string &wire) {
+    assert(wireSchema == getWireSchema());
+
+    try {
+        size_t offset = 0;
+        boost::uint64_t start = readUint64(wire, offset);
+        string scope = readString(wire.data(), wire.size(), offset);
+        return make_pair(getDataType(),
+                ReplayRequestPtr(
+                        new ReplayRequest(rsb::Scope(scope), start,
+                                rsb::Scope(wire.substr(offset)))));
+    } catch (const exception &e) {
+        throw rsb::converter::SerializationException(
+                string("Invalid replay request: ") + e.what());
+    }
+}
+
+}
+}
+}
@@ -0,0 +1,308 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "RingBuffer.h"
+
+#include <algorithm>
+#include <limits>
+
+#include <boost/functional/hash.hpp>
+
+#include <rsb/EventId.h>
+#include <rsb/MetaData.h>
+
+#include "SerializedPayload.h"
+
+using namespace std;
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+namespace {
+
+size_t nextPowerOfTwo(const size_t &value) {
+    size_t result = 2;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+bool deliveredBefore(rsb::EventPtr a, rsb::EventPtr b) {
+    return a->getMetaData().getDeliverTime()
+            < b->getMetaData().getDeliverTime();
+}
+
+}
+
+const boost::uint64_t RingBuffer::EMPTY_SLOT =
+        numeric_limits<boost::uint64_t>::max();
+
+bool RingBuffer::Key::operator==(const Key &other) const {
+    return sequenceNumber == other.sequenceNumber
+            && participantId == other.participantId;
+}
+
+RingBuffer::RingBuffer(const boost::uint64_t &deltaInMuSec,
+        const size_t &initialCapacity, const boost::uint64_t &maxBytes) :
+        logger(rsc::logging::Logger::getLogger("rsbbuffer.RingBuffer")), deltaInMuSec(
+                deltaInMuSec), ring(nextPowerOfTwo(initialCapacity)), ringMask(
+                ring.size() - 1), head(0), tail(0), index(2 * ring.size(),
+                EMPTY_SLOT), indexMask(index.size() - 1), latestDeletionTime(
+                0), maxBytes(maxBytes), storedBytes(0), evictedEvents(0), evictedBytes(
+                0) {
+}
+
+RingBuffer::~RingBuffer() {
+}
+
+RingBuffer::Key RingBuffer::makeKey(const rsb::EventId &id) {
+    Key key;
+    key.participantId = id.getParticipantId().getId();
+    key.sequenceNumber = id.getSequenceNumber();
+    return key;
+}
+
+size_t RingBuffer::hashKey(const Key &key) {
+    size_t hash = boost::uuids::hash_value(key.participantId);
+    boost::hash_combine(hash, key.sequenceNumber);
+    return hash;
+}
+
+RingBuffer::Entry &RingBuffer::entryAt(const boost::uint64_t &position) {
+    return ring[position & ringMask];
+}
+
+size_t RingBuffer::findSlot(const Key &key, const size_t &hash) const {
+    size_t slot = hash & indexMask;
+    while (index[slot] != EMPTY_SLOT) {
+        const Entry &entry = ring[index[slot] & ringMask];
+        if (entry.hash == hash && entry.key == key) {
+            break;
+        }
+        slot = (slot + 1) & indexMask;
+    }
+    return slot;
+}
+
+void RingBuffer::insert(rsb::EventPtr event) {
+    boost::mutex::scoped_lock lock(mutex);
+    RSCTRACE(logger, "Inserting event with ID " << event->getId());
+
+    // keep deletion times monotonic so that the ring stays sorted even if
+    // deliver times of concurrently received events interleave slightly
+    latestDeletionTime = max(latestDeletionTime,
+            event->getMetaData().getDeliverTime() + deltaInMuSec);
+    removeExpired(latestDeletionTime - deltaInMuSec);
+
+    Key key = makeKey(event->getId());
+    size_t hash = hashKey(key);
+    size_t slot = findSlot(key, hash);
+    if (index[slot] != EMPTY_SLOT) {
+        RSCDEBUG(logger,
+                "Ignoring duplicate event with ID " << event->getId());
+        return;
+    }
+
+    size_t bytes = getSerializedPayloadSize(event);
+    if (maxBytes > 0) {
+        if (bytes > maxBytes) {
+            RSCDEBUG(logger,
+                    "Rejecting event with ID " << event->getId() << " of " << bytes << " bytes exceeding the budget");
+            ++evictedEvents;
+            evictedBytes += bytes;
+            return;
+        }
+        if (storedBytes + bytes > maxBytes) {
+            if (evictedEvents == 0) {
+                RSCWARN(logger,
+                        "Byte budget of " << maxBytes << " exhausted. Evicting events before their retention time.");
+            }
+            while (storedBytes + bytes > maxBytes) {
+                evictedBytes += entryAt(tail).bytes;
+                ++evictedEvents;
+                removeTail();
+            }
+        }
+        // removing may have shifted the index
+        slot = findSlot(key, hash);
+    }
+
+    if (head - tail == ring.size()) {
+        grow();
+        slot = findSlot(key, hash);
+    }
+
+    Entry &entry = entryAt(head);
+    entry.key = key;
+    entry.hash = hash;
+    entry.deletionTime = latestDeletionTime;
+    entry.bytes = bytes;
+    entry.event = event;
+    index[slot] = head;
+    ++head;
+    storedBytes += bytes;
+
+    RSCTRACE(logger, "New size: " << head - tail);
+}
+
+rsb::EventPtr RingBuffer::get(const rsb::EventId &id) {
+    Key key = makeKey(id);
+    size_t hash = hashKey(key);
+
+    boost::mutex::scoped_lock lock(mutex);
+    size_t slot = findSlot(key, hash);
+    if (index[slot] != EMPTY_SLOT) {
+        return entryAt(index[slot]).event;
+    } else {
+        return rsb::EventPtr();
+    }
+}
+
+void RingBuffer::getRange(const rsb::Scope &scope,
+        const boost::uint64_t &start, const boost::uint64_t &end,
+        vector<rsb::EventPtr> &events) {
+    boost::mutex::scoped_lock lock(mutex);
+
+    // deletion times are monotonic and no earlier than the deliver times,
+    // all entries before the first one not before start are out of range
+    boost::uint64_t first = tail;
+    boost::uint64_t count = head - tail;
+    while (count > 0) {
+        boost::uint64_t step = count / 2;
+        if (entryAt(first + step).deletionTime - deltaInMuSec < start) {
+            first += step + 1;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+
+    // deletion times only bound the deliver times from above, so an event
+    // delivered out of order may follow entries after the end of the range
+    size_t offset = events.size();
+    for (boost::uint64_t position = first; position != head; ++position) {
+        const Entry &entry = entryAt(position);
+        if (isInRange(entry.event, scope, start, end)) {
+            events.push_back(entry.event);
+        }
+    }
+    stable_sort(events.begin() + offset, events.end(), deliveredBefore);
+}
+
+size_t RingBuffer::size() {
+    boost::mutex::scoped_lock lock(mutex);
+    return head - tail;
+}
+
+boost::uint64_t RingBuffer::getStoredBytes() {
+    boost::mutex::scoped_lock lock(mutex);
+    return storedBytes;
+}
+
+boost::uint64_t RingBuffer::getEvictedEvents() {
+    boost::mutex::scoped_lock lock(mutex);
+    return evictedEvents;
+}
+
+boost::uint64_t RingBuffer::getEvictedBytes() {
+    boost::mutex::scoped_lock lock(mutex);
+    return evictedBytes;
+}
+
+void RingBuffer::removeOld(const boost::uint64_t &now) {
+    boost::mutex::scoped_lock lock(mutex);
+    removeExpired(now);
+}
+
+void RingBuffer::removeExpired(const boost::uint64_t &now) {
+    while (tail != head && entryAt(tail).deletionTime <= now) {
+        removeTail();
+    }
+}
+
+void RingBuffer::removeTail() {
+
+    Entry &entry = entryAt(tail);
+
+    // backward shift deletion keeps probe sequences intact without tombstones
+    size_t hole = findSlot(entry.key, entry.hash);
+    assert(index[hole] == tail);
+    size_t next = hole;
+    while (true) {
+        next = (next + 1) & indexMask;
+        if (index[next] == EMPTY_SLOT) {
+            break;
+        }
+        size_t home = entryAt(index[next]).hash & indexMask;
+        bool homeBetween =
+                hole <= next ?
+                        (hole < home && home <= next) :
+                        (hole < home || home <= next);
+        if (!homeBetween) {
+            index[hole] = index[next];
+            hole = next;
+        }
+    }
+    index[hole] = EMPTY_SLOT;
+
+    storedBytes -= entry.bytes;
+    entry.event.reset();
+    ++tail;
+
+}
+
+void RingBuffer::grow() {
+
+    RSCDEBUG(logger, "Growing ring from capacity " << ring.size());
+
+    vector<Entry> newRing(2 * ring.size());
+    size_t newRingMask = newRing.size() - 1;
+    for (boost::uint64_t position = tail; position != head; ++position) {
+        Entry &newEntry = newRing[position & newRingMask];
+        Entry &oldEntry = entryAt(position);
+        newEntry.key = oldEntry.key;
+        newEntry.hash = oldEntry.hash;
+        newEntry.deletionTime = oldEntry.deletionTime;
+        newEntry.bytes = oldEntry.bytes;
+        newEntry.event.swap(oldEntry.event);
+    }
+    ring.swap(newRing);
+    ringMask = newRingMask;
+
+    index.assign(2 * ring.size(), EMPTY_SLOT);
+    indexMask = index.size() - 1;
+    for (boost::uint64_t position = tail; position != head; ++position) {
+        const Entry &entry = entryAt(position);
+        index[findSlot(entry.key, entry.hash)] = position;
+    }
+
+}
+
+}
+}
+}
@@ -0,0 +1,191 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/thread.hpp>
+#include <boost/uuid/uuid.hpp>
+
+#include <rsc/logging/Logger.h>
+
+#include "Buffer.h"
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * A time bounded buffer which stores events in an append-only ring ordered by
+ * their deliver time. Events are found via an open-addressing hash index from
+ * their EventId to the ring slot. Expiring events thus only advances the tail
+ * of the ring and lookups do not require any tree traversal.
+ *
+ * The current time for the expiry is derived from the deliver timestamps of
+ * the inserted events, which are set by RSB shortly before dispatching to the
+ * handlers.
+ *
+ * Optionally, the buffer enforces a budget for the serialized payload bytes
+ * of all stored events (see SerializedPayload). If it would be exceeded, the
+ * oldest events are evicted before their retention time has passed.
+ */
+class RingBuffer: public Buffer {
+public:
+
+    /**
+     * Creates a new buffer.
+     *
+     * @param deltaInMuSec time to retain events after their delivery
+     * @param initialCapacity number of events the ring can hold before it has
+     *                        to grow. Rounded up to the next power of two.
+     * @param maxBytes maximum number of serialized payload bytes to store or
+     *                 0 for no limit. Events larger than this limit are not
+     *                 stored at all.
+     */
+    RingBuffer(const boost::uint64_t &deltaInMuSec,
+            const std::size_t &initialCapacity = 1024,
+            const boost::uint64_t &maxBytes = 0);
+    virtual ~RingBuffer();
+
+    void insert(rsb::EventPtr event);
+    rsb::EventPtr get(const rsb::EventId &id);
+    void removeOld(const boost::uint64_t &now);
+
+    /**
+     * Collects events with a binary search on the monotonic deletion times
+     * for the first candidate. As deletion times only bound the deliver
+     * times from above, the ring is scanned from there up to the newest
+     * event and the matching events are sorted by their deliver times.
+     * Hence, events delivered out of order are found as well.
+     */
+    void getRange(const rsb::Scope &scope, const boost::uint64_t &start,
+            const boost::uint64_t &end, std::vector<rsb::EventPtr> &events);
+
+    /**
+     * Returns the number of events currently stored in the buffer.
+     *
+     * @return number of stored events
+     */
+    std::size_t size();
+
+    /**
+     * Returns the serialized payload bytes of all stored events.
+     *
+     * @return stored bytes
+     */
+    boost::uint64_t getStoredBytes();
+
+    /**
+     * Returns the number of events which were removed or rejected before
+     * their retention time passed to stay within the byte budget.
+     *
+     * @return evicted events since creation
+     */
+    boost::uint64_t getEvictedEvents();
+
+    /**
+     * Returns the serialized payload bytes of all events counted by
+     * #getEvictedEvents.
+     *
+     * @return evicted bytes since creation
+     */
+    boost::uint64_t getEvictedBytes();
+
+private:
+
+    /**
+     * A lightweight representation of an EventId which can be stored in
+     * preallocated arrays.
+     */
+    struct Key {
+        boost::uuids::uuid participantId;
+        boost::uint32_t sequenceNumber;
+
+        bool operator==(const Key &other) const;
+    };
+
+    struct Entry {
+        Key key;
+        std::size_t hash;
+        boost::uint64_t deletionTime;
+        std::size_t bytes;
+        rsb::EventPtr event;
+    };
+
+    static const boost::uint64_t EMPTY_SLOT;
+
+    static Key makeKey(const rsb::EventId &id);
+    static std::size_t hashKey(const Key &key);
+
+    Entry &entryAt(const boost::uint64_t &position);
+
+    /**
+     * Returns the index slot containing the ring position of the event with
+     * the given key or the empty slot where such a position would have to be
+     * inserted.
+     */
+    std::size_t findSlot(const Key &key, const std::size_t &hash) const;
+
+    void removeExpired(const boost::uint64_t &now);
+    void removeTail();
+    void grow();
+
+    rsc::logging::LoggerPtr logger;
+
+    boost::uint64_t deltaInMuSec;
+
+    boost::mutex mutex;
+
+    /**
+     * Ring of events in insertion order. Positions are absolute and increase
+     * monotonically. The slot of a position is position & #ringMask.
+     */
+    std::vector<Entry> ring;
+    std::size_t ringMask;
+    boost::uint64_t head;
+    boost::uint64_t tail;
+
+    /**
+     * Open-addressing hash table with linear probing, storing absolute ring
+     * positions or #EMPTY_SLOT. Kept at most half full.
+     */
+    std::vector<boost::uint64_t> index;
+    std::size_t indexMask;
+
+    boost::uint64_t latestDeletionTime;
+
+    boost::uint64_t maxBytes;
+    boost::uint64_t storedBytes;
+    boost::uint64_t evictedEvents;
+    boost::uint64_t evictedBytes;
+
+};
+
+}
+}
+}
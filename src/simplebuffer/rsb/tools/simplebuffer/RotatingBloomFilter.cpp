@@ -0,0 +1,168 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "RotatingBloomFilter.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <boost/uuid/uuid.hpp>
+
+using namespace std;
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+namespace {
+
+/**
+ * Finalizer of MurmurHash3 to spread the bits of the input.
+ */
+boost::uint64_t mix(boost::uint64_t value) {
+    value ^= value >> 33;
+    value *= UINT64_C(0xff51afd7ed558ccd);
+    value ^= value >> 33;
+    value *= UINT64_C(0xc4ceb9fe1a85ec53);
+    value ^= value >> 33;
+    return value;
+}
+
+}
+
+const unsigned int RotatingBloomFilter::GENERATIONS = 4;
+// optimal for the 10 bits per expected entry allocated below
+const unsigned int RotatingBloomFilter::HASHES = 7;
+
+RotatingBloomFilter::RotatingBloomFilter(
+        const boost::uint64_t &retentionInMuSec,
+        const size_t &expectedEntries) :
+        windowInMuSec(max(retentionInMuSec / 2 + retentionInMuSec % 2,
+                boost::uint64_t(1))), currentWindow(0) {
+
+    boost::uint64_t numBits = 64;
+    while (numBits < boost::uint64_t(expectedEntries) * 10) {
+        numBits <<= 1;
+    }
+    bitMask = numBits - 1;
+    wordsPerGeneration = numBits / 64;
+
+    bits.reset(
+            new boost::atomic<boost::uint64_t>[GENERATIONS
+                    * wordsPerGeneration]);
+    for (size_t i = 0; i < GENERATIONS * wordsPerGeneration; ++i) {
+        bits[i].store(0, boost::memory_order_relaxed);
+    }
+
+}
+
+RotatingBloomFilter::~RotatingBloomFilter() {
+}
+
+void RotatingBloomFilter::hashId(const rsb::EventId &id,
+        boost::uint64_t &first, boost::uint64_t &second) {
+    boost::uuids::uuid participantId = id.getParticipantId().getId();
+    boost::uint64_t high;
+    boost::uint64_t low;
+    memcpy(&high, participantId.data, sizeof(high));
+    memcpy(&low, participantId.data + sizeof(high), sizeof(low));
+    first = mix(high ^ mix(low ^ id.getSequenceNumber()));
+    // odd, so that all positions differ for power of two sizes
+    second = mix(first ^ UINT64_C(0x9e3779b97f4a7c15)) | 1;
+}
+
+boost::atomic<boost::uint64_t> &RotatingBloomFilter::word(
+        const unsigned int &generation, const boost::uint64_t &bit) const {
+    return bits[generation * wordsPerGeneration + (bit >> 6)];
+}
+
+void RotatingBloomFilter::add(const rsb::EventId &id) {
+    boost::uint64_t first;
+    boost::uint64_t second;
+    hashId(id, first, second);
+    unsigned int generation = currentWindow.load(boost::memory_order_acquire)
+            % GENERATIONS;
+    for (unsigned int i = 0; i < HASHES; ++i) {
+        boost::uint64_t bit = (first + i * second) & bitMask;
+        word(generation, bit).fetch_or(boost::uint64_t(1) << (bit & 63),
+                boost::memory_order_release);
+    }
+}
+
+bool RotatingBloomFilter::mightContain(const rsb::EventId &id) const {
+    boost::uint64_t first;
+    boost::uint64_t second;
+    hashId(id, first, second);
+    for (unsigned int generation = 0; generation < GENERATIONS;
+            ++generation) {
+        bool contained = true;
+        for (unsigned int i = 0; contained && i < HASHES; ++i) {
+            boost::uint64_t bit = (first + i * second) & bitMask;
+            contained = (word(generation, bit).load(
+                    boost::memory_order_acquire)
+                    & (boost::uint64_t(1) << (bit & 63))) != 0;
+        }
+        if (contained) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void RotatingBloomFilter::advance(const boost::uint64_t &now) {
+
+    boost::uint64_t window = now / windowInMuSec;
+    if (window <= currentWindow.load(boost::memory_order_acquire)) {
+        return;
+    }
+
+    boost::mutex::scoped_lock lock(rotationMutex);
+    boost::uint64_t current = currentWindow.load(boost::memory_order_relaxed);
+    if (window <= current) {
+        return;
+    }
+
+    // clear the generations of all skipped windows, but each one only once
+    boost::uint64_t first = max(current + 1,
+            window - min(window, boost::uint64_t(GENERATIONS - 1)));
+    for (boost::uint64_t reused = first; reused <= window; ++reused) {
+        unsigned int generation = reused % GENERATIONS;
+        for (size_t i = 0; i < wordsPerGeneration; ++i) {
+            bits[generation * wordsPerGeneration + i].store(0,
+                    boost::memory_order_relaxed);
+        }
+    }
+    currentWindow.store(window, boost::memory_order_release);
+
+}
+
+size_t RotatingBloomFilter::getBitsPerGeneration() const {
+    return wordsPerGeneration * 64;
+}
+
+}
+}
+}
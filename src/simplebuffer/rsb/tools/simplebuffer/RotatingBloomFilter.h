@@ -0,0 +1,130 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_array.hpp>
+#include <boost/thread.hpp>
+
+#include <rsb/EventId.h>
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * A probabilistic set of EventIds which forgets its entries after a
+ * retention time. It may report IDs as contained which were never added, but
+ * never reports an added ID as missing before its retention time has passed.
+ *
+ * The filter consists of several generations of Bloom filters. Each one
+ * receives the additions of one time window, which is half of the retention
+ * time. Once a generation is reused for a new window, it is cleared. Thus
+ * entries are kept between one and a half and twice the retention time, which
+ * tolerates slightly unordered timestamps.
+ *
+ * #add and #mightContain only perform atomic operations on the bit arrays.
+ * Only advancing to a new window is serialized by a mutex.
+ */
+class RotatingBloomFilter: private boost::noncopyable {
+public:
+
+    /**
+     * Creates a new filter.
+     *
+     * @param retentionInMuSec minimum time to remember added IDs for
+     * @param expectedEntries number of IDs which are expected to be added
+     *                        within half of the retention time. The filter
+     *                        has about 1% false positives at this load.
+     */
+    RotatingBloomFilter(const boost::uint64_t &retentionInMuSec,
+            const std::size_t &expectedEntries);
+    virtual ~RotatingBloomFilter();
+
+    /**
+     * Adds an ID to the generation of the current window.
+     *
+     * @param id the ID to add
+     */
+    void add(const rsb::EventId &id);
+
+    /**
+     * Tells whether an ID might have been added within the retention time.
+     *
+     * @param id the ID to test
+     * @return @c false if the ID was definitely not added within the
+     *         retention time
+     */
+    bool mightContain(const rsb::EventId &id) const;
+
+    /**
+     * Advances the current window to the one containing @a now and clears the
+     * generations which are reused by this. Times before the current window
+     * are ignored.
+     *
+     * @param now current time in musec
+     */
+    void advance(const boost::uint64_t &now);
+
+    /**
+     * Returns the number of bits in each generation.
+     *
+     * @return bits per generation
+     */
+    std::size_t getBitsPerGeneration() const;
+
+    static const unsigned int GENERATIONS;
+    static const unsigned int HASHES;
+
+private:
+
+    /**
+     * Computes the two base hashes of an ID which are combined to the
+     * bit positions via double hashing.
+     */
+    static void hashId(const rsb::EventId &id, boost::uint64_t &first,
+            boost::uint64_t &second);
+
+    boost::atomic<boost::uint64_t> &word(const unsigned int &generation,
+            const boost::uint64_t &bit) const;
+
+    boost::uint64_t windowInMuSec;
+
+    std::size_t wordsPerGeneration;
+    boost::uint64_t bitMask;
+    boost::scoped_array<boost::atomic<boost::uint64_t> > bits;
+
+    boost::atomic<boost::uint64_t> currentWindow;
+    boost::mutex rotationMutex;
+
+};
+
+}
+}
+}
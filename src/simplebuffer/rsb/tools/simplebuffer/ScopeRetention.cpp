@@ -0,0 +1,131 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "ScopeRetention.h"
+
+#include <stdexcept>
+
+#include <stdlib.h>
+
+using namespace std;
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+namespace {
+
+/**
+ * Parses a leading unsigned integer and returns the remaining suffix.
+ */
+boost::uint64_t parseNumber(const string &value, string &suffix) {
+    if (value.empty() || value[0] < '0' || value[0] > '9') {
+        throw invalid_argument("Expected a number instead of '" + value + "'.");
+    }
+    char *end = 0;
+    boost::uint64_t number = strtoull(value.c_str(), &end, 10);
+    suffix = end;
+    return number;
+}
+
+boost::uint64_t parseTime(const string &value) {
+    string unit;
+    boost::uint64_t number = parseNumber(value, unit);
+    if (unit.empty() || unit == "us") {
+        return number;
+    } else if (unit == "ms") {
+        return number * 1000;
+    } else if (unit == "s") {
+        return number * 1000000;
+    } else if (unit == "min") {
+        return number * 60000000;
+    }
+    throw invalid_argument("Unknown time unit '" + unit + "'.");
+}
+
+boost::uint64_t parseBytes(const string &value) {
+    string unit;
+    boost::uint64_t number = parseNumber(value, unit);
+    if (unit.empty()) {
+        return number;
+    } else if (unit == "K") {
+        return number << 10;
+    } else if (unit == "M") {
+        return number << 20;
+    } else if (unit == "G") {
+        return number << 30;
+    }
+    throw invalid_argument("Unknown size unit '" + unit + "'.");
+}
+
+}
+
+ScopeRetention::ScopeRetention(const rsb::Scope &scope,
+        const boost::uint64_t &timeMuSec, const boost::uint64_t &maxBytes) :
+        scope(scope), timeMuSec(timeMuSec), maxBytes(maxBytes) {
+}
+
+ScopeRetention::~ScopeRetention() {
+}
+
+ScopeRetention ScopeRetention::parse(const string &spec,
+        const boost::uint64_t &defaultTimeMuSec,
+        const boost::uint64_t &defaultMaxBytes) {
+
+    // scope names cannot contain colons
+    size_t timeStart = spec.find(':');
+    if (timeStart == string::npos) {
+        return ScopeRetention(rsb::Scope(spec), defaultTimeMuSec,
+                defaultMaxBytes);
+    }
+
+    rsb::Scope scope(spec.substr(0, timeStart));
+    size_t bytesStart = spec.find(':', timeStart + 1);
+    boost::uint64_t time = parseTime(
+            spec.substr(timeStart + 1, bytesStart - timeStart - 1));
+    boost::uint64_t bytes = defaultMaxBytes;
+    if (bytesStart != string::npos) {
+        bytes = parseBytes(spec.substr(bytesStart + 1));
+    }
+    return ScopeRetention(scope, time, bytes);
+
+}
+
+rsb::Scope ScopeRetention::getScope() const {
+    return scope;
+}
+
+boost::uint64_t ScopeRetention::getTimeMuSec() const {
+    return timeMuSec;
+}
+
+boost::uint64_t ScopeRetention::getMaxBytes() const {
+    return maxBytes;
+}
+
+}
+}
+}
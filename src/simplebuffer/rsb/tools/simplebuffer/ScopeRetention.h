@@ -0,0 +1,88 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <string>
+
+#include <boost/cstdint.hpp>
+
+#include <rsb/Scope.h>
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * Retention settings for the events of one subscribed scope.
+ */
+class ScopeRetention {
+public:
+
+    /**
+     * Creates new settings.
+     *
+     * @param scope subscribed scope
+     * @param timeMuSec time to retain events after their delivery
+     * @param maxBytes maximum serialized payload bytes to retain or 0 for no
+     *                 limit
+     */
+    ScopeRetention(const rsb::Scope &scope, const boost::uint64_t &timeMuSec,
+            const boost::uint64_t &maxBytes);
+    virtual ~ScopeRetention();
+
+    /**
+     * Parses settings of the form SCOPE[:TIME[:BYTES]]. TIME is an integer
+     * with one of the units us, ms, s or min and defaults to microseconds.
+     * BYTES is an integer with an optional suffix K, M or G for powers of
+     * 1024.
+     *
+     * @param spec the specification to parse
+     * @param defaultTimeMuSec time to use if @a spec does not contain one
+     * @param defaultMaxBytes byte limit to use if @a spec does not contain
+     *                        one
+     * @return parsed settings
+     * @throw std::invalid_argument @a spec is malformed
+     */
+    static ScopeRetention parse(const std::string &spec,
+            const boost::uint64_t &defaultTimeMuSec,
+            const boost::uint64_t &defaultMaxBytes);
+
+    rsb::Scope getScope() const;
+    boost::uint64_t getTimeMuSec() const;
+    boost::uint64_t getMaxBytes() const;
+
+private:
+
+    rsb::Scope scope;
+    boost::uint64_t timeMuSec;
+    boost::uint64_t maxBytes;
+
+};
+
+}
+}
+}
@@ -0,0 +1,132 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "ScopedBuffer.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <rsb/EventId.h>
+#include <rsb/MetaData.h>
+
+using namespace std;
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+namespace {
+
+bool deliveredBefore(rsb::EventPtr a, rsb::EventPtr b) {
+    return a->getMetaData().getDeliverTime()
+            < b->getMetaData().getDeliverTime();
+}
+
+}
+
+ScopedBuffer::ScopedBuffer(const map<rsb::Scope, BufferPtr> &buffers) :
+        logger(rsc::logging::Logger::getLogger("rsbbuffer.ScopedBuffer")), buffers(
+                buffers) {
+    if (buffers.empty()) {
+        throw invalid_argument("At least one scope is required.");
+    }
+}
+
+ScopedBuffer::~ScopedBuffer() {
+}
+
+BufferPtr ScopedBuffer::bufferFor(const rsb::Scope &scope) const {
+    // super scopes are ordered from the root to the scope itself
+    vector<rsb::Scope> candidates = scope.superScopes(true);
+    for (vector<rsb::Scope>::reverse_iterator it = candidates.rbegin();
+            it != candidates.rend(); ++it) {
+        map<rsb::Scope, BufferPtr>::const_iterator bufferIt = buffers.find(
+                *it);
+        if (bufferIt != buffers.end()) {
+            return bufferIt->second;
+        }
+    }
+    return BufferPtr();
+}
+
+void ScopedBuffer::insert(rsb::EventPtr event) {
+    BufferPtr buffer = bufferFor(*event->getScopePtr());
+    if (buffer) {
+        buffer->insert(event);
+    } else {
+        RSCDEBUG(logger,
+                "Dropping event " << event->getId() << " on unconfigured scope " << *event->getScopePtr());
+    }
+}
+
+rsb::EventPtr ScopedBuffer::get(const rsb::EventId &id) {
+    for (map<rsb::Scope, BufferPtr>::const_iterator it = buffers.begin();
+            it != buffers.end(); ++it) {
+        rsb::EventPtr event = it->second->get(id);
+        if (event) {
+            return event;
+        }
+    }
+    return rsb::EventPtr();
+}
+
+void ScopedBuffer::getRange(const rsb::Scope &scope,
+        const boost::uint64_t &start, const boost::uint64_t &end,
+        vector<rsb::EventPtr> &events) {
+    size_t offset = events.size();
+    for (map<rsb::Scope, BufferPtr>::const_iterator it = buffers.begin();
+            it != buffers.end(); ++it) {
+        // skip children which cannot contain events on the requested scope
+        if (it->first != scope && !it->first.isSuperScopeOf(scope)
+                && !scope.isSuperScopeOf(it->first)) {
+            continue;
+        }
+        size_t childOffset = events.size();
+        it->second->getRange(scope, start, end, events);
+        inplace_merge(events.begin() + offset, events.begin() + childOffset,
+                events.end(), deliveredBefore);
+    }
+}
+
+size_t ScopedBuffer::size() {
+    size_t count = 0;
+    for (map<rsb::Scope, BufferPtr>::const_iterator it = buffers.begin();
+            it != buffers.end(); ++it) {
+        count += it->second->size();
+    }
+    return count;
+}
+
+void ScopedBuffer::removeOld(const boost::uint64_t &now) {
+    for (map<rsb::Scope, BufferPtr>::const_iterator it = buffers.begin();
+            it != buffers.end(); ++it) {
+        it->second->removeOld(now);
+    }
+}
+
+}
+}
+}
@@ -0,0 +1,78 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <map>
+
+#include <rsc/logging/Logger.h>
+
+#include <rsb/Scope.h>
+
+#include "Buffer.h"
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * A buffer which stores events in separate child buffers per scope, e.g. to
+ * retain high-rate scopes for a shorter time than others. Each event is
+ * inserted into the child of the most specific configured scope which
+ * equals or contains the event's scope. Events on other scopes are dropped.
+ */
+class ScopedBuffer: public Buffer {
+public:
+
+    /**
+     * Creates a new buffer.
+     *
+     * @param buffers child buffers by scope
+     * @throw std::invalid_argument @a buffers is empty
+     */
+    explicit ScopedBuffer(const std::map<rsb::Scope, BufferPtr> &buffers);
+    virtual ~ScopedBuffer();
+
+    void insert(rsb::EventPtr event);
+    rsb::EventPtr get(const rsb::EventId &id);
+    void removeOld(const boost::uint64_t &now);
+    void getRange(const rsb::Scope &scope, const boost::uint64_t &start,
+            const boost::uint64_t &end, std::vector<rsb::EventPtr> &events);
+    std::size_t size();
+
+private:
+
+    BufferPtr bufferFor(const rsb::Scope &scope) const;
+
+    rsc::logging::LoggerPtr logger;
+
+    std::map<rsb::Scope, BufferPtr> buffers;
+
+};
+
+}
+}
+}
@@ -0,0 +1,266 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "SegmentFile.h"
+
+#include <cassert>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/uuid/uuid.hpp>
+
+#include "BinaryEncoding.h"
+#include "EventRecord.h"
+
+using namespace std;
+namespace ip = boost::interprocess;
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+namespace {
+
+const char MAGIC[] = "RSBSEG01";
+
+/**
+ * magic, index slots, event count, data capacity, data end, min and max
+ * deliver time
+ */
+const size_t HEADER_SIZE = 64;
+
+/**
+ * participant id and sequence number, used flag, record offset
+ */
+const size_t SLOT_SIZE = 32;
+const size_t SLOT_KEY_SIZE = 20;
+const size_t SLOT_USED = 20;
+const size_t SLOT_OFFSET = 24;
+
+/**
+ * record length and deliver time
+ */
+const size_t RECORD_PREFIX_SIZE = 12;
+
+}
+
+SegmentFile::SegmentFile(const string &path, const size_t &dataCapacity,
+        const size_t &indexSlots) :
+        path(path), dataCapacity(dataCapacity), indexSlots(indexSlots), base(
+                0), data(0), eventCount(0), dataEnd(0), minDeliverTime(
+                numeric_limits<boost::uint64_t>::max()), maxDeliverTime(0) {
+
+    if (indexSlots < 2) {
+        throw invalid_argument("A segment requires at least two index slots.");
+    }
+
+    const size_t fileSize = HEADER_SIZE + indexSlots * SLOT_SIZE
+            + dataCapacity;
+    {
+        // reserve all blocks up front: writing to a sparse mapping raises
+        // SIGBUS instead of reporting an error once the disk is full. The
+        // reserved blocks read as zero, hence the index slots are unused.
+        int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) {
+            throw runtime_error(
+                    "Unable to create segment file " + path + ": "
+                            + strerror(errno));
+        }
+        int error = posix_fallocate(fd, 0, fileSize);
+        ::close(fd);
+        if (error != 0) {
+            std::remove(path.c_str());
+            throw runtime_error(
+                    "Unable to allocate " + boost::lexical_cast<string>(fileSize)
+                            + " bytes for segment file " + path + ": "
+                            + strerror(error));
+        }
+    }
+
+    try {
+        ip::file_mapping mapping(path.c_str(), ip::read_write);
+        region.reset(new ip::mapped_region(mapping, ip::read_write));
+    } catch (const ip::interprocess_exception &e) {
+        std::remove(path.c_str());
+        throw runtime_error(
+                "Unable to map segment file " + path + ": " + e.what());
+    }
+    base = static_cast<char*>(region->get_address());
+    data = base + HEADER_SIZE + indexSlots * SLOT_SIZE;
+    writeHeader();
+
+}
+
+SegmentFile::~SegmentFile() {
+}
+
+bool SegmentFile::append(const rsb::EventId &id,
+        const boost::uint64_t &deliverTime, const string &record) {
+
+    // keep the index at most half full for short probe sequences
+    if ((eventCount + 1) * 2 > indexSlots
+            || dataCapacity - dataEnd < RECORD_PREFIX_SIZE + record.size()) {
+        return false;
+    }
+
+    size_t slot = findSlot(id);
+    if (slotAt(slot)[SLOT_USED]) {
+        // already stored
+        return true;
+    }
+
+    string prefix;
+    writeUint32(prefix, record.size());
+    writeUint64(prefix, deliverTime);
+    memcpy(data + dataEnd, prefix.data(), prefix.size());
+    memcpy(data + dataEnd + prefix.size(), record.data(), record.size());
+
+    string entry;
+    boost::uuids::uuid participant = id.getParticipantId().getId();
+    entry.append(participant.begin(), participant.end());
+    writeUint32(entry, id.getSequenceNumber());
+    writeUint32(entry, 1);
+    writeUint64(entry, dataEnd);
+    memcpy(slotAt(slot), entry.data(), entry.size());
+
+    dataEnd += prefix.size() + record.size();
+    ++eventCount;
+    minDeliverTime = min(minDeliverTime, deliverTime);
+    maxDeliverTime = max(maxDeliverTime, deliverTime);
+    writeHeader();
+
+    return true;
+
+}
+
+rsb::EventPtr SegmentFile::get(const rsb::EventId &id) const {
+    const char *slot = slotAt(findSlot(id));
+    if (!slot[SLOT_USED]) {
+        return rsb::EventPtr();
+    }
+    size_t offset = SLOT_OFFSET;
+    offset = readUint64(slot, SLOT_SIZE, offset);
+    size_t length = readUint32(data, dataEnd, offset);
+    readUint64(data, dataEnd, offset);
+    return decodeEventRecord(data + offset, length);
+}
+
+void SegmentFile::getRange(const boost::uint64_t &start,
+        const boost::uint64_t &end, vector<rsb::EventPtr> &events) const {
+    if (eventCount == 0 || end < minDeliverTime || start > maxDeliverTime) {
+        return;
+    }
+    size_t offset = 0;
+    while (offset < dataEnd) {
+        size_t length = readUint32(data, dataEnd, offset);
+        boost::uint64_t deliverTime = readUint64(data, dataEnd, offset);
+        if (deliverTime >= start && deliverTime <= end) {
+            events.push_back(decodeEventRecord(data + offset, length));
+        }
+        offset += length;
+    }
+}
+
+size_t SegmentFile::getEventCount() const {
+    return eventCount;
+}
+
+boost::uint64_t SegmentFile::getMinDeliverTime() const {
+    return minDeliverTime;
+}
+
+boost::uint64_t SegmentFile::getMaxDeliverTime() const {
+    return maxDeliverTime;
+}
+
+string SegmentFile::getPath() const {
+    return path;
+}
+
+void SegmentFile::remove() {
+    region.reset();
+    base = 0;
+    data = 0;
+    std::remove(path.c_str());
+}
+
+boost::uint64_t SegmentFile::hashId(const rsb::EventId &id) {
+    // FNV-1a, which is stable across processes and library versions
+    boost::uint64_t hash = UINT64_C(14695981039346656037);
+    boost::uuids::uuid participant = id.getParticipantId().getId();
+    for (boost::uuids::uuid::const_iterator it = participant.begin();
+            it != participant.end(); ++it) {
+        hash = (hash ^ *it) * UINT64_C(1099511628211);
+    }
+    boost::uint32_t sequenceNumber = id.getSequenceNumber();
+    for (size_t i = 0; i < sizeof(sequenceNumber); ++i) {
+        hash = (hash ^ ((sequenceNumber >> (8 * i)) & 0xff))
+                * UINT64_C(1099511628211);
+    }
+    return hash;
+}
+
+size_t SegmentFile::findSlot(const rsb::EventId &id) const {
+    boost::uuids::uuid participant = id.getParticipantId().getId();
+    string key(participant.begin(), participant.end());
+    writeUint32(key, id.getSequenceNumber());
+    assert(key.size() == SLOT_KEY_SIZE);
+
+    size_t slot = hashId(id) % indexSlots;
+    while (slotAt(slot)[SLOT_USED]
+            && memcmp(slotAt(slot), key.data(), SLOT_KEY_SIZE)) {
+        slot = (slot + 1) % indexSlots;
+    }
+    return slot;
+}
+
+char *SegmentFile::slotAt(const size_t &slot) const {
+    return base + HEADER_SIZE + slot * SLOT_SIZE;
+}
+
+void SegmentFile::writeHeader() {
+    string header(MAGIC, sizeof(MAGIC) - 1);
+    writeUint32(header, indexSlots);
+    writeUint32(header, eventCount);
+    writeUint64(header, dataCapacity);
+    writeUint64(header, dataEnd);
+    writeUint64(header, minDeliverTime);
+    writeUint64(header, maxDeliverTime);
+    memcpy(base, header.data(), header.size());
+}
+
+}
+}
+}
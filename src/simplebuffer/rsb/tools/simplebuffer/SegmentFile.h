@@ -0,0 +1,144 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <rsb/Event.h>
+#include <rsb/EventId.h>
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * An append-only file of encoded events (see EventRecord) which is memory
+ * mapped as a whole. The file starts with a header and an open-addressing
+ * hash table from EventId to record offset, followed by the records in
+ * append order. Hence events can be found and read directly from the
+ * mapping without any further file I/O. The file is self-describing so that
+ * it can be inspected after the process terminated.
+ *
+ * Instances are not thread-safe.
+ */
+class SegmentFile: private boost::noncopyable {
+public:
+
+    /**
+     * Creates a new segment file, replacing any existing file.
+     *
+     * @param path the file to create
+     * @param dataCapacity bytes reserved for records
+     * @param indexSlots number of slots in the EventId hash table. The
+     *                   segment accepts up to half as many events.
+     * @throw std::runtime_error the file cannot be created, its space cannot
+     *                            be allocated on disk or it cannot be mapped
+     */
+    SegmentFile(const std::string &path, const std::size_t &dataCapacity,
+            const std::size_t &indexSlots);
+
+    /**
+     * Unmaps the file but keeps it on disk. Use #remove to delete it.
+     */
+    virtual ~SegmentFile();
+
+    /**
+     * Appends an encoded event.
+     *
+     * @param id id of the encoded event
+     * @param deliverTime deliver time of the encoded event
+     * @param record the encoded event
+     * @return @c false if the segment is full and nothing was appended
+     */
+    bool append(const rsb::EventId &id, const boost::uint64_t &deliverTime,
+            const std::string &record);
+
+    /**
+     * Decodes a stored event.
+     *
+     * @param id id of the event to look up
+     * @return the event or an empty pointer if it is not in this segment
+     */
+    rsb::EventPtr get(const rsb::EventId &id) const;
+
+    /**
+     * Decodes all events delivered in the closed interval [start, end] in
+     * append order.
+     */
+    void getRange(const boost::uint64_t &start, const boost::uint64_t &end,
+            std::vector<rsb::EventPtr> &events) const;
+
+    std::size_t getEventCount() const;
+    boost::uint64_t getMinDeliverTime() const;
+    boost::uint64_t getMaxDeliverTime() const;
+    std::string getPath() const;
+
+    /**
+     * Unmaps and deletes the file. The segment must not be used afterwards.
+     */
+    void remove();
+
+private:
+
+    static boost::uint64_t hashId(const rsb::EventId &id);
+
+    /**
+     * Returns the index slot containing the event or the empty slot where it
+     * would have to be inserted.
+     */
+    std::size_t findSlot(const rsb::EventId &id) const;
+    char *slotAt(const std::size_t &slot) const;
+    void writeHeader();
+
+    std::string path;
+    std::size_t dataCapacity;
+    std::size_t indexSlots;
+
+    boost::scoped_ptr<boost::interprocess::mapped_region> region;
+    char *base;
+    char *data;
+
+    std::size_t eventCount;
+    std::size_t dataEnd;
+    boost::uint64_t minDeliverTime;
+    boost::uint64_t maxDeliverTime;
+
+};
+
+typedef boost::shared_ptr<SegmentFile> SegmentFilePtr;
+
+}
+}
+}
@@ -0,0 +1,67 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <string>
+#include <utility>
+
+#include <boost/shared_ptr.hpp>
+
+#include <rsb/Event.h>
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * Payload type of events received with the SchemaAndByteArrayConverter: the
+ * wire schema and the unconverted wire bytes.
+ */
+typedef std::pair<std::string, std::string> SerializedPayload;
+typedef boost::shared_ptr<SerializedPayload> SerializedPayloadPtr;
+
+/**
+ * Returns the unconverted payload of an event.
+ *
+ * @param event the event to inspect
+ * @return the payload or an empty pointer if the event does not carry a
+ *         SerializedPayload
+ */
+SerializedPayloadPtr getSerializedPayload(rsb::EventPtr event);
+
+/**
+ * Returns the number of bytes the unconverted payload of an event occupies.
+ *
+ * @param event the event to inspect
+ * @return size of wire schema and wire bytes or 0 if the event does not carry
+ *         a SerializedPayload
+ */
+std::size_t getSerializedPayloadSize(rsb::EventPtr event);
+
+}
+}
+}
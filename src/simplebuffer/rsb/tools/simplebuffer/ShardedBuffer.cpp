@@ -0,0 +1,114 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "ShardedBuffer.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <boost/cstdint.hpp>
+#include <boost/functional/hash.hpp>
+#include <boost/uuid/uuid.hpp>
+
+#include <rsb/EventId.h>
+#include <rsb/MetaData.h>
+
+using namespace std;
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+namespace {
+
+bool deliveredBefore(rsb::EventPtr a, rsb::EventPtr b) {
+    return a->getMetaData().getDeliverTime()
+            < b->getMetaData().getDeliverTime();
+}
+
+}
+
+ShardedBuffer::ShardedBuffer(const vector<BufferPtr> &shards) :
+        shards(shards) {
+    if (shards.empty()) {
+        throw invalid_argument("At least one shard is required.");
+    }
+}
+
+ShardedBuffer::~ShardedBuffer() {
+}
+
+BufferPtr ShardedBuffer::shardFor(const rsb::EventId &id) const {
+    size_t hash = boost::uuids::hash_value(id.getParticipantId().getId());
+    boost::hash_combine(hash, id.getSequenceNumber());
+    // Child buffers may index by the low bits of the same hash. Use the high
+    // bits of a multiplicative mix so that events within one shard do not
+    // cluster in the child's hash table.
+    boost::uint64_t mixed = boost::uint64_t(hash)
+            * UINT64_C(0x9E3779B97F4A7C15);
+    return shards[(mixed >> 32) % shards.size()];
+}
+
+void ShardedBuffer::insert(rsb::EventPtr event) {
+    shardFor(event->getId())->insert(event);
+}
+
+rsb::EventPtr ShardedBuffer::get(const rsb::EventId &id) {
+    return shardFor(id)->get(id);
+}
+
+void ShardedBuffer::getRange(const rsb::Scope &scope,
+        const boost::uint64_t &start, const boost::uint64_t &end,
+        vector<rsb::EventPtr> &events) {
+    size_t offset = events.size();
+    for (vector<BufferPtr>::const_iterator it = shards.begin();
+            it != shards.end(); ++it) {
+        size_t shardOffset = events.size();
+        (*it)->getRange(scope, start, end, events);
+        inplace_merge(events.begin() + offset, events.begin() + shardOffset,
+                events.end(), deliveredBefore);
+    }
+}
+
+size_t ShardedBuffer::size() {
+    size_t count = 0;
+    for (vector<BufferPtr>::const_iterator it = shards.begin();
+            it != shards.end(); ++it) {
+        count += (*it)->size();
+    }
+    return count;
+}
+
+void ShardedBuffer::removeOld(const boost::uint64_t &now) {
+    for (vector<BufferPtr>::const_iterator it = shards.begin();
+            it != shards.end(); ++it) {
+        (*it)->removeOld(now);
+    }
+}
+
+}
+}
+}
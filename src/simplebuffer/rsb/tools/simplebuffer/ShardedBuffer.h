@@ -0,0 +1,78 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <vector>
+
+#include "Buffer.h"
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * A buffer which distributes events over a fixed set of independent child
+ * buffers based on a hash of their EventId. As each child has its own lock,
+ * listener threads inserting events for different scopes rarely contend with
+ * each other or with lookups.
+ */
+class ShardedBuffer: public Buffer {
+public:
+
+    /**
+     * Creates a new sharded buffer.
+     *
+     * @param shards the child buffers to distribute events over. Must not be
+     *               empty.
+     */
+    explicit ShardedBuffer(const std::vector<BufferPtr> &shards);
+    virtual ~ShardedBuffer();
+
+    void insert(rsb::EventPtr event);
+    rsb::EventPtr get(const rsb::EventId &id);
+    void removeOld(const boost::uint64_t &now);
+    void getRange(const rsb::Scope &scope, const boost::uint64_t &start,
+            const boost::uint64_t &end, std::vector<rsb::EventPtr> &events);
+    std::size_t size();
+
+    /**
+     * Returns the child buffer responsible for the given id.
+     *
+     * @param id id of an event
+     * @return shard storing the event if it exists
+     */
+    BufferPtr shardFor(const rsb::EventId &id) const;
+
+private:
+
+    std::vector<BufferPtr> shards;
+
+};
+
+}
+}
+}
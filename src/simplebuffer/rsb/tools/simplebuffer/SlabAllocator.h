@@ -0,0 +1,131 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <new>
+
+#include "SlabArena.h"
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * A standard allocator which takes single objects from the SlabPool of a
+ * SlabArena matching their size. Requests for arrays are forwarded to the
+ * global heap. This way the nodes of node based containers like std::map are
+ * recycled inside the arena.
+ *
+ * The arena must outlive all containers using allocators referring to it.
+ */
+template<class T>
+class SlabAllocator {
+public:
+
+    typedef T value_type;
+    typedef T *pointer;
+    typedef const T *const_pointer;
+    typedef T &reference;
+    typedef const T &const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    template<class U>
+    struct rebind {
+        typedef SlabAllocator<U> other;
+    };
+
+    explicit SlabAllocator(SlabArena &arena) :
+            arena(&arena), pool(&arena.poolFor(sizeof(T))) {
+    }
+
+    template<class U>
+    SlabAllocator(const SlabAllocator<U> &other) :
+            arena(other.getArena()), pool(&arena->poolFor(sizeof(T))) {
+    }
+
+    pointer allocate(size_type n, const void */*hint*/= 0) {
+        if (n == 1) {
+            return static_cast<pointer>(pool->allocate());
+        }
+        return static_cast<pointer>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(pointer p, size_type n) {
+        if (n == 1) {
+            pool->deallocate(p);
+        } else {
+            ::operator delete(p);
+        }
+    }
+
+    void construct(pointer p, const T &value) {
+        new (p) T(value);
+    }
+
+    void destroy(pointer p) {
+        p->~T();
+    }
+
+    pointer address(reference r) const {
+        return &r;
+    }
+
+    const_pointer address(const_reference r) const {
+        return &r;
+    }
+
+    size_type max_size() const {
+        return std::numeric_limits<size_type>::max() / sizeof(T);
+    }
+
+    SlabArena *getArena() const {
+        return arena;
+    }
+
+private:
+
+    SlabArena *arena;
+    SlabPool *pool;
+
+};
+
+template<class T, class U>
+bool operator==(const SlabAllocator<T> &a, const SlabAllocator<U> &b) {
+    return a.getArena() == b.getArena();
+}
+
+template<class T, class U>
+bool operator!=(const SlabAllocator<T> &a, const SlabAllocator<U> &b) {
+    return !(a == b);
+}
+
+}
+}
+}
@@ -0,0 +1,66 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "SlabArena.h"
+
+using namespace std;
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+SlabArena::SlabArena() {
+}
+
+SlabArena::~SlabArena() {
+}
+
+SlabPool &SlabArena::poolFor(const size_t &chunkSize) {
+    // only a handful of node types share an arena, a linear search suffices
+    for (vector<boost::shared_ptr<SlabPool> >::iterator it = pools.begin();
+            it != pools.end(); ++it) {
+        // pools round the requested size up to the chunk alignment
+        if ((*it)->getChunkSize() >= chunkSize
+                && (*it)->getChunkSize() < chunkSize + 2 * sizeof(void*)) {
+            return **it;
+        }
+    }
+    pools.push_back(boost::shared_ptr<SlabPool>(new SlabPool(chunkSize)));
+    return *pools.back();
+}
+
+size_t SlabArena::getSlabCount() const {
+    size_t count = 0;
+    for (vector<boost::shared_ptr<SlabPool> >::const_iterator it =
+            pools.begin(); it != pools.end(); ++it) {
+        count += (*it)->getSlabCount();
+    }
+    return count;
+}
+
+}
+}
+}
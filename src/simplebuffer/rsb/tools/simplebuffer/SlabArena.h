@@ -0,0 +1,76 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "SlabPool.h"
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * A set of SlabPools for different chunk sizes owned by a single buffer.
+ * Pools are created on first request and live as long as the arena.
+ *
+ * Instances are not thread-safe.
+ */
+class SlabArena: private boost::noncopyable {
+public:
+
+    SlabArena();
+    virtual ~SlabArena();
+
+    /**
+     * Returns the pool handing out chunks of at least the given size.
+     *
+     * @param chunkSize requested chunk size in bytes
+     * @return pool owned by this arena
+     */
+    SlabPool &poolFor(const std::size_t &chunkSize);
+
+    /**
+     * Returns the number of slabs allocated by all pools of this arena.
+     *
+     * @return slab count
+     */
+    std::size_t getSlabCount() const;
+
+private:
+
+    std::vector<boost::shared_ptr<SlabPool> > pools;
+
+};
+
+}
+}
+}
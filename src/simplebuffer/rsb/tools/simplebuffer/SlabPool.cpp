@@ -0,0 +1,95 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "SlabPool.h"
+
+#include <algorithm>
+#include <new>
+
+using namespace std;
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+namespace {
+
+/**
+ * Alignment of memory returned by malloc on all supported platforms.
+ */
+const size_t CHUNK_ALIGNMENT = 2 * sizeof(void*);
+
+}
+
+SlabPool::SlabPool(const size_t &chunkSize, const size_t &chunksPerSlab) :
+        chunkSize(
+                (max(chunkSize, sizeof(FreeChunk)) + CHUNK_ALIGNMENT - 1)
+                        / CHUNK_ALIGNMENT * CHUNK_ALIGNMENT), chunksPerSlab(
+                max(chunksPerSlab, size_t(1))), freeList(0) {
+}
+
+SlabPool::~SlabPool() {
+    for (vector<char*>::iterator it = slabs.begin(); it != slabs.end(); ++it) {
+        ::operator delete(*it);
+    }
+}
+
+void *SlabPool::allocate() {
+    if (!freeList) {
+        addSlab();
+    }
+    FreeChunk *chunk = freeList;
+    freeList = chunk->next;
+    return chunk;
+}
+
+void SlabPool::deallocate(void *chunk) {
+    FreeChunk *freeChunk = static_cast<FreeChunk*>(chunk);
+    freeChunk->next = freeList;
+    freeList = freeChunk;
+}
+
+size_t SlabPool::getChunkSize() const {
+    return chunkSize;
+}
+
+size_t SlabPool::getSlabCount() const {
+    return slabs.size();
+}
+
+void SlabPool::addSlab() {
+    slabs.reserve(slabs.size() + 1);
+    char *slab = static_cast<char*>(::operator new(chunkSize * chunksPerSlab));
+    slabs.push_back(slab);
+    // thread the chunks in address order
+    for (size_t i = chunksPerSlab; i > 0; --i) {
+        deallocate(slab + (i - 1) * chunkSize);
+    }
+}
+
+}
+}
+}
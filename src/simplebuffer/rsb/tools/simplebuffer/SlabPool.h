@@ -0,0 +1,106 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * Hands out memory chunks of a fixed size which are carved from larger slabs.
+ * Released chunks are kept in a free list and reused by later allocations.
+ * Slabs are only returned to the heap when the pool is destroyed, hence a
+ * buffer in steady state does not allocate from the heap anymore and does
+ * not fragment it.
+ *
+ * Instances are not thread-safe.
+ */
+class SlabPool: private boost::noncopyable {
+public:
+
+    /**
+     * Creates a new pool.
+     *
+     * @param chunkSize size of the chunks to hand out in bytes. Rounded up to
+     *                  the alignment guaranteed by the global operator new.
+     * @param chunksPerSlab number of chunks to allocate at once when the free
+     *                      list is empty
+     */
+    explicit SlabPool(const std::size_t &chunkSize,
+            const std::size_t &chunksPerSlab = 256);
+    virtual ~SlabPool();
+
+    /**
+     * Returns an uninitialized chunk of #getChunkSize bytes.
+     *
+     * @return pointer to the chunk
+     * @throw std::bad_alloc no new slab could be allocated
+     */
+    void *allocate();
+
+    /**
+     * Returns a chunk to the pool.
+     *
+     * @param chunk a chunk obtained from #allocate of this pool
+     */
+    void deallocate(void *chunk);
+
+    std::size_t getChunkSize() const;
+
+    /**
+     * Returns the number of slabs allocated from the heap so far.
+     *
+     * @return slab count
+     */
+    std::size_t getSlabCount() const;
+
+private:
+
+    /**
+     * Overlays the memory of unused chunks.
+     */
+    struct FreeChunk {
+        FreeChunk *next;
+    };
+
+    void addSlab();
+
+    std::size_t chunkSize;
+    std::size_t chunksPerSlab;
+    std::vector<char*> slabs;
+    FreeChunk *freeList;
+
+};
+
+}
+}
+}
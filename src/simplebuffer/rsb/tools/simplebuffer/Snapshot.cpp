@@ -0,0 +1,198 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "Snapshot.h"
+
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include <rsc/logging/Logger.h>
+
+#include <rsb/MetaData.h>
+
+#include "BinaryEncoding.h"
+#include "EventRecord.h"
+
+using namespace std;
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+namespace {
+
+const char MAGIC[] = "RSBSNP01";
+
+/**
+ * Size of the length and deliver time prefix of each record.
+ */
+const size_t RECORD_HEADER_SIZE = 12;
+
+rsc::logging::LoggerPtr getLogger() {
+    static rsc::logging::LoggerPtr logger = rsc::logging::Logger::getLogger(
+            "rsbbuffer.Snapshot");
+    return logger;
+}
+
+}
+
+size_t saveSnapshot(BufferPtr buffer, const string &path) {
+
+    vector<rsb::EventPtr> events;
+    buffer->getRange(rsb::Scope("/"), 0,
+            numeric_limits<boost::uint64_t>::max(), events);
+
+    const string temporaryPath = path + ".tmp";
+    ofstream file(temporaryPath.c_str(), ios::out | ios::binary | ios::trunc);
+    if (!file) {
+        throw runtime_error("Cannot open " + temporaryPath + " for writing.");
+    }
+    file.write(MAGIC, sizeof(MAGIC) - 1);
+
+    size_t written = 0;
+    size_t skipped = 0;
+    string record;
+    for (vector<rsb::EventPtr>::const_iterator it = events.begin();
+            it != events.end(); ++it) {
+        record.clear();
+        writeUint32(record, 0);
+        writeUint64(record, (*it)->getMetaData().getDeliverTime());
+        try {
+            encodeEventRecord(*it, record);
+        } catch (const invalid_argument &) {
+            ++skipped;
+            continue;
+        }
+        string length;
+        writeUint32(length, record.size() - RECORD_HEADER_SIZE);
+        record.replace(0, length.size(), length);
+        file.write(record.data(), record.size());
+        ++written;
+    }
+
+    file.close();
+    if (!file) {
+        remove(temporaryPath.c_str());
+        throw runtime_error("Cannot write snapshot " + temporaryPath);
+    }
+    if (rename(temporaryPath.c_str(), path.c_str()) != 0) {
+        remove(temporaryPath.c_str());
+        throw runtime_error("Cannot replace snapshot " + path);
+    }
+
+    if (skipped > 0) {
+        RSCWARN(getLogger(),
+                "Skipped " << skipped << " events without serialized payload");
+    }
+    return written;
+
+}
+
+size_t loadSnapshot(const string &path, BufferPtr buffer,
+        const boost::uint64_t &expiredBefore) {
+
+    ifstream file(path.c_str(), ios::in | ios::binary);
+    if (!file) {
+        throw runtime_error("Cannot open " + path + " for reading.");
+    }
+
+    char magic[sizeof(MAGIC) - 1];
+    if (!file.read(magic, sizeof(magic))
+            || string(magic, sizeof(magic)) != string(MAGIC, sizeof(magic))) {
+        throw runtime_error(path + " is not a buffer snapshot.");
+    }
+
+    // record lengths may be garbage in damaged snapshots, hence they are
+    // bounded by the remaining size of the file
+    file.seekg(0, ios::end);
+    boost::uint64_t remaining = boost::uint64_t(file.tellg()) - sizeof(magic);
+    file.seekg(sizeof(magic), ios::beg);
+    if (!file) {
+        throw runtime_error("Cannot read " + path);
+    }
+
+    size_t inserted = 0;
+    size_t expired = 0;
+    bool truncated = false;
+    char header[RECORD_HEADER_SIZE];
+    vector<char> record;
+    while (file.read(header, sizeof(header))) {
+
+        remaining -= sizeof(header);
+        size_t offset = 0;
+        boost::uint32_t length = readUint32(header, sizeof(header), offset);
+        boost::uint64_t deliverTime = readUint64(header, sizeof(header),
+                offset);
+
+        if (length > remaining) {
+            truncated = true;
+            break;
+        }
+        remaining -= length;
+
+        if (deliverTime < expiredBefore) {
+            if (!file.seekg(length, ios::cur)) {
+                break;
+            }
+            ++expired;
+            continue;
+        }
+
+        if (length == 0) {
+            throw runtime_error("Empty record in snapshot " + path);
+        }
+        record.resize(length);
+        if (!file.read(&record[0], length)) {
+            truncated = true;
+            break;
+        }
+        rsb::EventPtr event;
+        try {
+            event = decodeEventRecord(&record[0], length);
+        } catch (const exception &e) {
+            throw runtime_error(
+                    "Corrupt record in snapshot " + path + ": " + e.what());
+        }
+        buffer->insert(event);
+        ++inserted;
+
+    }
+
+    if (truncated || file.gcount() != 0) {
+        RSCWARN(getLogger(), "Ignoring truncated last record in " << path);
+    }
+    RSCDEBUG(getLogger(),
+            "Loaded " << inserted << " events from " << path << ", skipped " << expired << " expired ones");
+    return inserted;
+
+}
+
+}
+}
+}
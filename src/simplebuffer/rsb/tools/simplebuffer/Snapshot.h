@@ -0,0 +1,76 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <string>
+
+#include <boost/cstdint.hpp>
+
+#include "Buffer.h"
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * Writes all events stored in a buffer to a snapshot file in the order of
+ * their deliver times. Events are stored as records created with
+ * #encodeEventRecord. The file is written to a temporary file next to
+ * @a path first and renamed afterwards so that an existing snapshot is only
+ * replaced by a complete one.
+ *
+ * @param buffer buffer to dump
+ * @param path file to write
+ * @return number of written events. Events without a SerializedPayload are
+ *         skipped.
+ * @throw std::runtime_error the file cannot be written
+ */
+std::size_t saveSnapshot(BufferPtr buffer, const std::string &path);
+
+/**
+ * Inserts the events of a snapshot file created with #saveSnapshot into a
+ * buffer. Records are read one after another from the file so that only a
+ * single encoded event is held in memory at a time. Records of events
+ * delivered before @a expiredBefore are skipped without decoding them.
+ *
+ * A truncated last record is ignored. This includes a record whose length
+ * exceeds the rest of the file.
+ *
+ * @param path file to read
+ * @param buffer buffer to insert the events into
+ * @param expiredBefore deliver time in microseconds before which events are
+ *                      expired anyway
+ * @return number of inserted events
+ * @throw std::runtime_error the file cannot be read, is not a snapshot or
+ *                            contains a record which cannot be decoded
+ */
+std::size_t loadSnapshot(const std::string &path, BufferPtr buffer,
+        const boost::uint64_t &expiredBefore);
+
+}
+}
+}
@@ -0,0 +1,236 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "SpillingBuffer.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+
+#include <rsc/misc/UUID.h>
+
+#include <rsb/EventId.h>
+#include <rsb/MetaData.h>
+
+#include "EventRecord.h"
+#include "SerializedPayload.h"
+
+using namespace std;
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+namespace {
+
+bool deliveredBefore(rsb::EventPtr a, rsb::EventPtr b) {
+    return a->getMetaData().getDeliverTime()
+            < b->getMetaData().getDeliverTime();
+}
+
+}
+
+SpillingBuffer::SpillingBuffer(BufferPtr hot,
+        const boost::uint64_t &hotDeltaInMuSec,
+        const boost::uint64_t &deltaInMuSec, const string &directory,
+        const size_t &segmentBytes, const size_t &segmentIndexSlots) :
+        logger(rsc::logging::Logger::getLogger("rsbbuffer.SpillingBuffer")), hot(
+                hot), hotDeltaInMuSec(hotDeltaInMuSec), deltaInMuSec(
+                deltaInMuSec), directory(directory), segmentBytes(
+                segmentBytes), segmentIndexSlots(segmentIndexSlots), segmentPrefix(
+                rsc::misc::UUID().getIdAsString()), nextSegmentNumber(0), latestDeliverTime(
+                0) {
+    if (hotDeltaInMuSec > deltaInMuSec) {
+        throw invalid_argument(
+                "The hot window must not be longer than the retention time.");
+    }
+}
+
+SpillingBuffer::~SpillingBuffer() {
+    for (deque<SegmentFilePtr>::iterator it = segments.begin();
+            it != segments.end(); ++it) {
+        (*it)->remove();
+    }
+}
+
+void SpillingBuffer::insert(rsb::EventPtr event) {
+    boost::mutex::scoped_lock lock(mutex);
+    latestDeliverTime = max(latestDeliverTime,
+            event->getMetaData().getDeliverTime());
+    pending.push_back(event);
+    hot->insert(event);
+    advance(latestDeliverTime);
+}
+
+rsb::EventPtr SpillingBuffer::get(const rsb::EventId &id) {
+
+    // events are only removed from the hot buffer after they were spilled
+    // while holding the mutex
+    rsb::EventPtr event = hot->get(id);
+    if (event) {
+        return event;
+    }
+
+    boost::mutex::scoped_lock lock(mutex);
+    for (deque<SegmentFilePtr>::reverse_iterator it = segments.rbegin();
+            it != segments.rend(); ++it) {
+        event = (*it)->get(id);
+        if (event) {
+            return event;
+        }
+    }
+    return rsb::EventPtr();
+
+}
+
+void SpillingBuffer::removeOld(const boost::uint64_t &now) {
+    boost::mutex::scoped_lock lock(mutex);
+    advance(now);
+}
+
+void SpillingBuffer::getRange(const rsb::Scope &scope,
+        const boost::uint64_t &start, const boost::uint64_t &end,
+        vector<rsb::EventPtr> &events) {
+    boost::mutex::scoped_lock lock(mutex);
+
+    vector<rsb::EventPtr> hotEvents;
+    hot->getRange(scope, start, end, hotEvents);
+    set<rsb::EventId> hotIds;
+    for (vector<rsb::EventPtr>::const_iterator it = hotEvents.begin();
+            it != hotEvents.end(); ++it) {
+        hotIds.insert((*it)->getId());
+    }
+
+    // spilled events may still be retained by the hot buffer for a moment
+    size_t offset = events.size();
+    vector<rsb::EventPtr> coldEvents;
+    for (deque<SegmentFilePtr>::const_iterator it = segments.begin();
+            it != segments.end(); ++it) {
+        coldEvents.clear();
+        (*it)->getRange(start, end, coldEvents);
+        for (vector<rsb::EventPtr>::const_iterator eventIt =
+                coldEvents.begin(); eventIt != coldEvents.end(); ++eventIt) {
+            if (isInRange(*eventIt, scope, start, end)
+                    && !hotIds.count((*eventIt)->getId())) {
+                events.push_back(*eventIt);
+            }
+        }
+    }
+
+    // segments return their events in append order, which differs from the
+    // delivery order for events which arrived out of order
+    size_t middle = events.size();
+    stable_sort(events.begin() + offset, events.begin() + middle,
+            deliveredBefore);
+    events.insert(events.end(), hotEvents.begin(), hotEvents.end());
+    inplace_merge(events.begin() + offset, events.begin() + middle,
+            events.end(), deliveredBefore);
+
+}
+
+size_t SpillingBuffer::size() {
+    boost::mutex::scoped_lock lock(mutex);
+    size_t count = hot->size();
+    for (deque<SegmentFilePtr>::const_iterator it = segments.begin();
+            it != segments.end(); ++it) {
+        count += (*it)->getEventCount();
+    }
+    return count;
+}
+
+size_t SpillingBuffer::getSegmentCount() {
+    boost::mutex::scoped_lock lock(mutex);
+    return segments.size();
+}
+
+void SpillingBuffer::advance(const boost::uint64_t &now) {
+
+    while (!pending.empty()
+            && pending.front()->getMetaData().getDeliverTime()
+                    + hotDeltaInMuSec <= now) {
+        spill(pending.front());
+        pending.pop_front();
+    }
+
+    hot->removeOld(now);
+
+    while (!segments.empty()
+            && segments.front()->getMaxDeliverTime() + deltaInMuSec <= now) {
+        RSCDEBUG(logger,
+                "Removing expired segment " << segments.front()->getPath());
+        segments.front()->remove();
+        segments.pop_front();
+    }
+
+}
+
+void SpillingBuffer::spill(rsb::EventPtr event) {
+
+    if (!getSerializedPayload(event)) {
+        RSCTRACE(logger,
+                "Not spilling event " << event->getId() << " without unconverted payload");
+        return;
+    }
+    if (event->getMetaData().getDeliverTime() + deltaInMuSec
+            <= latestDeliverTime) {
+        return;
+    }
+
+    record.clear();
+    encodeEventRecord(event, record);
+
+    try {
+        if (segments.empty()
+                || !segments.back()->append(event->getId(),
+                        event->getMetaData().getDeliverTime(), record)) {
+            segments.push_back(createSegment());
+            if (!segments.back()->append(event->getId(),
+                    event->getMetaData().getDeliverTime(), record)) {
+                RSCWARN(logger,
+                        "Event " << event->getId() << " with " << record.size() << " bytes does not fit into a segment and is dropped");
+            }
+        }
+    } catch (const runtime_error &e) {
+        RSCERROR(logger,
+                "Unable to spill event " << event->getId() << ", dropping it: " << e.what());
+    }
+
+}
+
+SegmentFilePtr SpillingBuffer::createSegment() {
+    stringstream path;
+    path << directory << "/" << segmentPrefix << "-" << setw(8)
+            << setfill('0') << nextSegmentNumber++ << ".segment";
+    RSCDEBUG(logger, "Creating segment " << path.str());
+    return SegmentFilePtr(
+            new SegmentFile(path.str(), segmentBytes, segmentIndexSlots));
+}
+
+}
+}
+}
@@ -0,0 +1,143 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <deque>
+#include <string>
+
+#include <boost/cstdint.hpp>
+#include <boost/thread.hpp>
+
+#include <rsc/logging/Logger.h>
+
+#include "Buffer.h"
+#include "SegmentFile.h"
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * A buffer which keeps a hot window of recent events in another buffer and
+ * spills older events with a SerializedPayload to append-only, memory mapped
+ * SegmentFiles. Segments are deleted as a whole once all their events have
+ * expired. Events without a SerializedPayload are only kept in the hot
+ * buffer.
+ *
+ * The hot buffer must retain events for at least the hot window and must not
+ * expire events by itself based on the wall clock, as events are only moved
+ * to disk when this buffer is inserted into or #removeOld is called.
+ */
+class SpillingBuffer: public Buffer {
+public:
+
+    /**
+     * Creates a new buffer.
+     *
+     * @param hot buffer for recent events
+     * @param hotDeltaInMuSec time to keep events in @a hot after their
+     *                        delivery before spilling them to disk
+     * @param deltaInMuSec total time to retain events after their delivery
+     * @param directory existing directory for segment files
+     * @param segmentBytes bytes of event records per segment
+     * @param segmentIndexSlots slots of the EventId index of each segment
+     */
+    SpillingBuffer(BufferPtr hot, const boost::uint64_t &hotDeltaInMuSec,
+            const boost::uint64_t &deltaInMuSec, const std::string &directory,
+            const std::size_t &segmentBytes = 64 * 1024 * 1024,
+            const std::size_t &segmentIndexSlots = 1 << 16);
+
+    /**
+     * Deletes all remaining segment files.
+     */
+    virtual ~SpillingBuffer();
+
+    void insert(rsb::EventPtr event);
+    rsb::EventPtr get(const rsb::EventId &id);
+    void removeOld(const boost::uint64_t &now);
+    void getRange(const rsb::Scope &scope, const boost::uint64_t &start,
+            const boost::uint64_t &end, std::vector<rsb::EventPtr> &events);
+
+    /**
+     * Counts events in memory and on disk. Events which were just spilled
+     * may be counted twice until the hot buffer removes them.
+     */
+    std::size_t size();
+
+    /**
+     * Returns the number of segment files currently in use.
+     *
+     * @return segment count
+     */
+    std::size_t getSegmentCount();
+
+private:
+
+    /**
+     * Moves all events which left the hot window to disk and expires the
+     * hot buffer and old segments.
+     */
+    void advance(const boost::uint64_t &now);
+    void spill(rsb::EventPtr event);
+    SegmentFilePtr createSegment();
+
+    rsc::logging::LoggerPtr logger;
+
+    BufferPtr hot;
+    boost::uint64_t hotDeltaInMuSec;
+    boost::uint64_t deltaInMuSec;
+    std::string directory;
+    std::size_t segmentBytes;
+    std::size_t segmentIndexSlots;
+
+    boost::mutex mutex;
+
+    /**
+     * Events in the hot buffer in insertion order which still need to be
+     * spilled.
+     */
+    std::deque<rsb::EventPtr> pending;
+
+    /**
+     * Oldest segment first. Only the last one is appended to.
+     */
+    std::deque<SegmentFilePtr> segments;
+
+    std::string segmentPrefix;
+    boost::uint64_t nextSegmentNumber;
+    boost::uint64_t latestDeliverTime;
+
+    /**
+     * Reused for encoding events.
+     */
+    std::string record;
+
+};
+
+}
+}
+}
@@ -0,0 +1,54 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "StatisticsTask.h"
+
+#include <sstream>
+
+using namespace std;
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+StatisticsTask::StatisticsTask(InstrumentedBufferPtr buffer,
+        rsb::Informer<string>::Ptr informer, const unsigned int &periodMs) :
+        rsc::threading::PeriodicTask(periodMs), buffer(buffer), informer(
+                informer) {
+}
+
+StatisticsTask::~StatisticsTask() {
+}
+
+void StatisticsTask::execute() {
+    stringstream statistics;
+    buffer->printStatistics(statistics);
+    informer->publish(boost::shared_ptr<string>(new string(statistics.str())));
+}
+
+}
+}
+}
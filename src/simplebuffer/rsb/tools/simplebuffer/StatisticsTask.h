@@ -0,0 +1,71 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <string>
+
+#include <rsc/threading/PeriodicTask.h>
+
+#include <rsb/Informer.h>
+
+#include "InstrumentedBuffer.h"
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * A task which periodically publishes the statistics of an
+ * InstrumentedBuffer as a string, e.g. to watch them with the logger.
+ */
+class StatisticsTask: public rsc::threading::PeriodicTask {
+public:
+
+    /**
+     * Creates a new task.
+     *
+     * @param buffer the buffer to report on
+     * @param informer informer to publish the statistics with
+     * @param periodMs interval between two reports in milliseconds
+     */
+    StatisticsTask(InstrumentedBufferPtr buffer,
+            rsb::Informer<std::string>::Ptr informer,
+            const unsigned int &periodMs);
+    virtual ~StatisticsTask();
+
+    void execute();
+
+private:
+
+    InstrumentedBufferPtr buffer;
+    rsb::Informer<std::string>::Ptr informer;
+
+};
+
+}
+}
+}
@@ -0,0 +1,354 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "StreamingBuffer.h"
+
+#include <deque>
+#include <limits>
+#include <stdexcept>
+
+#include <boost/bind.hpp>
+
+#include <rsb/Factory.h>
+
+using namespace std;
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * Publishes the events of a single subscription from its own thread.
+ */
+class StreamingBuffer::Subscription {
+public:
+
+    Subscription(StreamingBuffer *owner, const ReplayRequest &request,
+            rsb::InformerBasePtr informer, const size_t &maxQueuedEvents) :
+            owner(owner), request(request), informer(informer), maxQueuedEvents(
+                    maxQueuedEvents), stopping(false), cancelled(false) {
+    }
+
+    ~Subscription() {
+        stop();
+    }
+
+    const ReplayRequest &getRequest() const {
+        return request;
+    }
+
+    void start(const vector<rsb::EventPtr> &replay) {
+        thread = boost::thread(
+                boost::bind(&Subscription::run, this, replay));
+    }
+
+    /**
+     * Queues a newly inserted event.
+     *
+     * @return @c false if the subscription is cancelled
+     */
+    bool enqueue(rsb::EventPtr event) {
+        boost::mutex::scoped_lock lock(mutex);
+        if (cancelled) {
+            return false;
+        }
+        if (queue.size() >= maxQueuedEvents) {
+            cancelled = true;
+            queued.notify_one();
+            return false;
+        }
+        queue.push_back(event);
+        queued.notify_one();
+        return true;
+    }
+
+    bool isCancelled() {
+        boost::mutex::scoped_lock lock(mutex);
+        return cancelled;
+    }
+
+    void stop() {
+        {
+            boost::mutex::scoped_lock lock(mutex);
+            stopping = true;
+        }
+        queued.notify_one();
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+
+private:
+
+    void run(const vector<rsb::EventPtr> &replay) {
+
+        for (vector<rsb::EventPtr>::const_iterator it = replay.begin();
+                it != replay.end(); ++it) {
+            if (isStopping() || !publish(*it)) {
+                return;
+            }
+        }
+
+        while (true) {
+            rsb::EventPtr event;
+            {
+                boost::mutex::scoped_lock lock(mutex);
+                while (queue.empty() && !stopping && !cancelled) {
+                    queued.wait(lock);
+                }
+                if (queue.empty() || cancelled) {
+                    return;
+                }
+                event = queue.front();
+                queue.pop_front();
+            }
+            if (!publish(event)) {
+                return;
+            }
+        }
+
+    }
+
+    bool isStopping() {
+        boost::mutex::scoped_lock lock(mutex);
+        return stopping;
+    }
+
+    bool publish(rsb::EventPtr event) {
+
+        rsb::EventPtr copy(new rsb::Event);
+        copy->setScope(request.getTarget().concat(*event->getScopePtr()));
+        copy->setMethod(event->getMethod());
+        copy->setType(event->getType());
+        copy->setData(event->getData());
+        copy->setMetaData(event->getMetaData());
+        copy->addCause(event->getId());
+
+        try {
+            owner->publish(informer, copy);
+            return true;
+        } catch (const exception &e) {
+            RSCERROR(owner->logger,
+                    "Cancelling subscription on " << request.getTarget() << " after failing to publish: " << e.what());
+            boost::mutex::scoped_lock lock(mutex);
+            cancelled = true;
+            return false;
+        }
+
+    }
+
+    StreamingBuffer *owner;
+    ReplayRequest request;
+    rsb::InformerBasePtr informer;
+    size_t maxQueuedEvents;
+
+    boost::mutex mutex;
+    boost::condition_variable queued;
+    deque<rsb::EventPtr> queue;
+    bool stopping;
+    bool cancelled;
+
+    boost::thread thread;
+
+};
+
+namespace {
+
+/**
+ * Tells whether events on one of both scopes can also be received on the
+ * other one.
+ */
+bool overlaps(const rsb::Scope &a, const rsb::Scope &b) {
+    return a == b || a.isSuperScopeOf(b) || b.isSuperScopeOf(a);
+}
+
+}
+
+StreamingBuffer::StreamingBuffer(BufferPtr buffer,
+        const rsb::ParticipantConfig &informerConfig,
+        const set<rsb::Scope> &bufferedScopes, const size_t &maxQueuedEvents) :
+        logger(rsc::logging::Logger::getLogger("rsbbuffer.StreamingBuffer")), buffer(
+                buffer), informerConfig(informerConfig), bufferedScopes(
+                bufferedScopes), maxQueuedEvents(maxQueuedEvents) {
+}
+
+StreamingBuffer::~StreamingBuffer() {
+    unsubscribeAll();
+}
+
+void StreamingBuffer::insert(rsb::EventPtr event) {
+
+    boost::shared_lock<boost::shared_mutex> lock(mutex);
+
+    buffer->insert(event);
+
+    const rsb::Scope &scope = *event->getScopePtr();
+    for (map<rsb::Scope, SubscriptionPtr>::const_iterator it =
+            subscriptions.begin(); it != subscriptions.end(); ++it) {
+        const rsb::Scope &requested = it->second->getRequest().getScope();
+        if ((requested == scope || requested.isSuperScopeOf(scope))
+                && !it->second->enqueue(event)) {
+            RSCTRACE(logger,
+                    "Subscription on " << it->first << " is cancelled");
+        }
+    }
+
+}
+
+rsb::EventPtr StreamingBuffer::get(const rsb::EventId &id) {
+    return buffer->get(id);
+}
+
+void StreamingBuffer::removeOld(const boost::uint64_t &now) {
+
+    buffer->removeOld(now);
+
+    vector<SubscriptionPtr> cancelled;
+    {
+        boost::unique_lock<boost::shared_mutex> lock(mutex);
+        for (map<rsb::Scope, SubscriptionPtr>::iterator it =
+                subscriptions.begin(); it != subscriptions.end();) {
+            if (it->second->isCancelled()) {
+                RSCWARN(logger,
+                        "Removing subscription on " << it->first << " which could not keep up");
+                cancelled.push_back(it->second);
+                subscriptions.erase(it++);
+            } else {
+                ++it;
+            }
+        }
+    }
+    // joining the threads happens outside of the lock
+
+}
+
+void StreamingBuffer::getRange(const rsb::Scope &scope,
+        const boost::uint64_t &start, const boost::uint64_t &end,
+        vector<rsb::EventPtr> &events) {
+    buffer->getRange(scope, start, end, events);
+}
+
+size_t StreamingBuffer::size() {
+    return buffer->size();
+}
+
+void StreamingBuffer::subscribe(const ReplayRequest &request) {
+
+    const rsb::Scope &target = request.getTarget();
+    if (overlaps(target, request.getScope())) {
+        throw invalid_argument(
+                "Target scope " + target.toString()
+                        + " overlaps the requested scope "
+                        + request.getScope().toString());
+    }
+    for (set<rsb::Scope>::const_iterator it = bufferedScopes.begin();
+            it != bufferedScopes.end(); ++it) {
+        if (overlaps(target, *it)) {
+            throw invalid_argument(
+                    "Target scope " + target.toString()
+                            + " overlaps the buffered scope "
+                            + it->toString());
+        }
+    }
+
+    rsb::InformerBasePtr informer = createInformer(request.getTarget());
+
+    // a replaced cancelled subscription joins its thread on destruction,
+    // which has to happen after releasing the lock
+    SubscriptionPtr cancelled;
+    boost::unique_lock<boost::shared_mutex> lock(mutex);
+
+    map<rsb::Scope, SubscriptionPtr>::const_iterator existing =
+            subscriptions.find(request.getTarget());
+    if (existing != subscriptions.end()) {
+        if (!existing->second->isCancelled()) {
+            throw invalid_argument(
+                    "There is already a subscription on "
+                            + request.getTarget().toString());
+        }
+        cancelled = existing->second;
+    }
+
+    // no event can be inserted between collecting the replay and
+    // registering the subscription, so none is lost or sent twice
+    vector<rsb::EventPtr> replay;
+    buffer->getRange(request.getScope(), request.getStart(),
+            numeric_limits<boost::uint64_t>::max(), replay);
+
+    SubscriptionPtr subscription(
+            new Subscription(this, request, informer, maxQueuedEvents));
+    subscriptions[request.getTarget()] = subscription;
+    subscription->start(replay);
+
+    RSCINFO(logger,
+            "Subscribed " << request.getTarget() << " to " << request.getScope() << ", replaying " << replay.size() << " events");
+    lock.unlock();
+
+}
+
+bool StreamingBuffer::unsubscribe(const rsb::Scope &target) {
+    SubscriptionPtr subscription;
+    {
+        boost::unique_lock<boost::shared_mutex> lock(mutex);
+        map<rsb::Scope, SubscriptionPtr>::iterator it = subscriptions.find(
+                target);
+        if (it == subscriptions.end()) {
+            return false;
+        }
+        subscription = it->second;
+        subscriptions.erase(it);
+    }
+    subscription->stop();
+    return true;
+}
+
+void StreamingBuffer::unsubscribeAll() {
+    map<rsb::Scope, SubscriptionPtr> stopped;
+    {
+        boost::unique_lock<boost::shared_mutex> lock(mutex);
+        stopped.swap(subscriptions);
+    }
+    // joining the threads happens outside of the lock
+}
+
+size_t StreamingBuffer::getSubscriptionCount() {
+    boost::shared_lock<boost::shared_mutex> lock(mutex);
+    return subscriptions.size();
+}
+
+rsb::InformerBasePtr StreamingBuffer::createInformer(
+        const rsb::Scope &target) {
+    return rsb::getFactory().createInformerBase(target, "", informerConfig);
+}
+
+void StreamingBuffer::publish(rsb::InformerBasePtr informer,
+        rsb::EventPtr event) {
+    informer->publish(event);
+}
+
+}
+}
+}
@@ -0,0 +1,174 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <map>
+#include <set>
+
+#include <boost/thread.hpp>
+
+#include <rsc/logging/Logger.h>
+
+#include <rsb/Informer.h>
+#include <rsb/ParticipantConfig.h>
+#include <rsb/Scope.h>
+
+#include "Buffer.h"
+#include "ReplayRequest.h"
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * A decorator which lets clients subscribe to the events of a buffer. A
+ * subscription first replays all stored events on a scope delivered after a
+ * requested time and then continues with the events inserted afterwards,
+ * without gaps or duplicates between both phases. Events are published on a
+ * target scope chosen by the client, each with the original scope appended
+ * and the original event as its cause.
+ *
+ * Each subscription publishes from its own thread. If a subscriber cannot
+ * keep up with newly inserted events and more than @a maxQueuedEvents are
+ * waiting, the subscription is cancelled.
+ */
+class StreamingBuffer: public Buffer {
+public:
+
+    /**
+     * Creates a new decorator.
+     *
+     * @param buffer the buffer to store events in
+     * @param informerConfig config for the informers of subscriptions. Has to
+     *                       pass payloads through unconverted.
+     * @param bufferedScopes scopes the buffer receives its events on. No
+     *                       subscription may publish onto or below them.
+     * @param maxQueuedEvents number of new events which may wait for being
+     *                        published per subscription
+     */
+    StreamingBuffer(BufferPtr buffer,
+            const rsb::ParticipantConfig &informerConfig,
+            const std::set<rsb::Scope> &bufferedScopes = std::set<rsb::Scope>(),
+            const std::size_t &maxQueuedEvents = 10000);
+
+    /**
+     * Cancels all subscriptions.
+     */
+    virtual ~StreamingBuffer();
+
+    void insert(rsb::EventPtr event);
+    rsb::EventPtr get(const rsb::EventId &id);
+
+    /**
+     * Also forgets cancelled subscriptions.
+     */
+    void removeOld(const boost::uint64_t &now);
+
+    void getRange(const rsb::Scope &scope, const boost::uint64_t &start,
+            const boost::uint64_t &end, std::vector<rsb::EventPtr> &events);
+    std::size_t size();
+
+    /**
+     * Starts a new subscription. Insertions are blocked while the events to
+     * replay are collected.
+     *
+     * @param request the subscription to start
+     * @throw std::invalid_argument a subscription for the target scope of
+     *                              @a request exists already or the target
+     *                              scope overlaps the requested scope or one
+     *                              of the buffered scopes, which would feed
+     *                              published events back into the buffer or
+     *                              the subscription
+     */
+    void subscribe(const ReplayRequest &request);
+
+    /**
+     * Cancels a subscription. Newly inserted events already queued for it are
+     * still published, an unfinished replay is aborted.
+     *
+     * @param target target scope of the subscription
+     * @return @c true if the subscription existed
+     */
+    bool unsubscribe(const rsb::Scope &target);
+
+    /**
+     * Cancels all subscriptions and waits for their threads to finish.
+     * Subclasses overriding #publish have to call this in their destructor
+     * because the threads call #publish until they are stopped.
+     */
+    void unsubscribeAll();
+
+    /**
+     * Returns the number of active subscriptions.
+     *
+     * @return number of subscriptions
+     */
+    std::size_t getSubscriptionCount();
+
+protected:
+
+    /**
+     * Creates the informer to publish the events of a subscription with.
+     *
+     * @param target target scope of the subscription
+     * @return the informer
+     */
+    virtual rsb::InformerBasePtr createInformer(const rsb::Scope &target);
+
+    /**
+     * Publishes an event of a subscription.
+     *
+     * @param informer informer created with #createInformer
+     * @param event the event to publish
+     */
+    virtual void publish(rsb::InformerBasePtr informer, rsb::EventPtr event);
+
+private:
+
+    class Subscription;
+    typedef boost::shared_ptr<Subscription> SubscriptionPtr;
+
+    rsc::logging::LoggerPtr logger;
+
+    BufferPtr buffer;
+    rsb::ParticipantConfig informerConfig;
+    std::set<rsb::Scope> bufferedScopes;
+    std::size_t maxQueuedEvents;
+
+    /**
+     * Held shared by insertions and exclusively while subscriptions change.
+     */
+    boost::shared_mutex mutex;
+    std::map<rsb::Scope, SubscriptionPtr> subscriptions;
+
+};
+
+typedef boost::shared_ptr<StreamingBuffer> StreamingBufferPtr;
+
+}
+}
+}
@@ -0,0 +1,61 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <rsb/patterns/LocalServer.h>
+
+#include "ReplayRequest.h"
+#include "StreamingBuffer.h"
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * Starts a subscription for a ReplayRequest. The reply is empty and sent
+ * once the replay has been collected, so that the client knows that all
+ * following events are published on its target scope. Requests whose target
+ * scope overlaps the requested or a buffered scope are answered with an
+ * error.
+ */
+class SubscribeRequestCallback: public rsb::patterns::LocalServer::AnyReplyTypeCallback<
+        ReplayRequest> {
+public:
+    SubscribeRequestCallback(StreamingBufferPtr buffer);
+    virtual ~SubscribeRequestCallback();
+
+    rsb::AnnotatedData call(const std::string &methodName,
+            boost::shared_ptr<ReplayRequest> input);
+
+private:
+    StreamingBufferPtr buffer;
+
+};
+
+}
+}
+}
@@ -26,68 +26,227 @@
 
 #include "TimeBoundedBuffer.h"
 
+#include <limits>
+#include <stdexcept>
+
+#include <rsc/misc/langutils.h>
+
 #include <rsb/EventId.h>
 #include <rsb/MetaData.h>
 
+#include "BlockCodec.h"
+#include "SerializedPayload.h"
+
 using namespace std;
 
 namespace rsb {
 namespace tools {
 namespace simplebuffer {
 
-TimeBoundedBuffer::TimeBoundedBuffer(const boost::uint64_t &deltaInMuSec) :
+TimeBoundedBuffer::TimeBoundedBuffer(const boost::uint64_t &deltaInMuSec,
+        bool expireOnInsert, const boost::uint64_t &compressAfterMuSec) :
         logger(rsc::logging::Logger::getLogger("rsbbuffer.TimeBoundedBuffer")), deltaInMuSec(
-                deltaInMuSec) {
+                deltaInMuSec), expireOnInsert(expireOnInsert), compressAfterMuSec(
+                compressAfterMuSec), eventMap(less<rsb::EventId>(),
+                EventMap::allocator_type(arena)), deletionTimeToId(
+                less<boost::uint64_t>(), DeletionTimeMap::allocator_type(arena)), compressedUntil(
+                0), uncompressedBytes(0), compressedBytes(0) {
 }
 
 TimeBoundedBuffer::~TimeBoundedBuffer() {
 }
 
 void TimeBoundedBuffer::insert(rsb::EventPtr event) {
-    boost::recursive_mutex::scoped_lock lock(mapsMutex);
-    RSCTRACE(logger, "Inserting event with ID " << event->getId());
-    eventMap.insert(make_pair(event->getId(), event));
-    deletionTimeToId.insert(
-            make_pair(event->getMetaData().getDeliverTime() + deltaInMuSec,
-                    event->getId()));
-    removeOld();
-    RSCTRACE(
-            logger,
-            "New sizes: " << eventMap.size() << " && " << deletionTimeToId.size());
-    assert(eventMap.size() == deletionTimeToId.size());
+    {
+        boost::recursive_mutex::scoped_lock lock(mapsMutex);
+        RSCTRACE(logger, "Inserting event with ID " << event->getId());
+        eventMap.insert(make_pair(event->getId(), event));
+        deletionTimeToId.insert(
+                make_pair(
+                        event->getMetaData().getDeliverTime() + deltaInMuSec,
+                        event->getId()));
+        RSCTRACE(
+                logger,
+                "New sizes: " << eventMap.size() << " && " << deletionTimeToId.size());
+        assert(eventMap.size() == deletionTimeToId.size());
+    }
+    // outside of the lock as it may compress payloads
+    if (expireOnInsert) {
+        removeOld(rsc::misc::currentTimeMicros());
+    }
 }
 
 rsb::EventPtr TimeBoundedBuffer::get(const rsb::EventId &id) {
+    rsb::EventPtr event;
+    {
+        boost::recursive_mutex::scoped_lock lock(mapsMutex);
+        EventMap::const_iterator it = eventMap.find(id);
+        if (it == eventMap.end()) {
+            return rsb::EventPtr();
+        }
+        event = it->second;
+    }
+    return decompress(event);
+}
+
+void TimeBoundedBuffer::getRange(const rsb::Scope &scope,
+        const boost::uint64_t &start, const boost::uint64_t &end,
+        vector<rsb::EventPtr> &events) {
+    size_t offset = events.size();
+    {
+        boost::recursive_mutex::scoped_lock lock(mapsMutex);
+
+        // deletion times are deliver times shifted by the constant delta
+        DeletionTimeMap::const_iterator it =
+                deletionTimeToId.lower_bound(start + deltaInMuSec);
+        DeletionTimeMap::const_iterator endRange =
+                end > numeric_limits<boost::uint64_t>::max() - deltaInMuSec ?
+                        deletionTimeToId.end() :
+                        deletionTimeToId.upper_bound(end + deltaInMuSec);
+        for (; it != endRange; ++it) {
+            EventMap::const_iterator eventIt = eventMap.find(it->second);
+            if (eventIt != eventMap.end()
+                    && isInRange(eventIt->second, scope, start, end)) {
+                events.push_back(eventIt->second);
+            }
+        }
+    }
+    for (vector<rsb::EventPtr>::iterator it = events.begin() + offset;
+            it != events.end(); ++it) {
+        *it = decompress(*it);
+    }
+}
+
+size_t TimeBoundedBuffer::size() {
     boost::recursive_mutex::scoped_lock lock(mapsMutex);
-    map<rsb::EventId, rsb::EventPtr>::const_iterator it = eventMap.find(id);
-    if (it != eventMap.end()) {
-        return it->second;
-    } else {
-        return rsb::EventPtr();
+    return eventMap.size();
+}
+
+void TimeBoundedBuffer::removeOld(const boost::uint64_t &now) {
+
+    {
+        boost::recursive_mutex::scoped_lock lock(mapsMutex);
+
+        DeletionTimeMap::iterator startRange = deletionTimeToId.begin();
+        DeletionTimeMap::iterator endRange = deletionTimeToId.upper_bound(now);
+        if (endRange != startRange) {
+
+            for (DeletionTimeMap::iterator it = startRange; it != endRange;
+                    ++it) {
+                eventMap.erase(it->second);
+            }
+
+            deletionTimeToId.erase(startRange, endRange);
+
+        }
+
+        assert(eventMap.size() == deletionTimeToId.size());
     }
+
+    if (compressAfterMuSec > 0 && compressAfterMuSec < deltaInMuSec) {
+        compress(now + (deltaInMuSec - compressAfterMuSec));
+    }
+
+}
+
+boost::uint64_t TimeBoundedBuffer::getUncompressedBytes() {
+    boost::recursive_mutex::scoped_lock lock(mapsMutex);
+    return uncompressedBytes;
 }
 
-void TimeBoundedBuffer::removeOld() {
+boost::uint64_t TimeBoundedBuffer::getCompressedBytes() {
     boost::recursive_mutex::scoped_lock lock(mapsMutex);
+    return compressedBytes;
+}
+
+void TimeBoundedBuffer::compress(const boost::uint64_t &limit) {
+
+    // collect the candidates under the lock but compress them without it so
+    // that insertions and lookups are not blocked meanwhile
+    vector<rsb::EventPtr> candidates;
+    {
+        boost::recursive_mutex::scoped_lock lock(mapsMutex);
+
+        // events inserted out of order behind the limit stay uncompressed
+        if (limit <= compressedUntil) {
+            return;
+        }
+        DeletionTimeMap::const_iterator endRange =
+                deletionTimeToId.upper_bound(limit);
+        for (DeletionTimeMap::const_iterator it =
+                deletionTimeToId.upper_bound(compressedUntil); it != endRange;
+                ++it) {
+            EventMap::const_iterator eventIt = eventMap.find(it->second);
+            if (eventIt != eventMap.end()
+                    && getSerializedPayload(eventIt->second)) {
+                candidates.push_back(eventIt->second);
+            }
+        }
+        compressedUntil = limit;
+    }
 
-    boost::uint64_t now = rsc::misc::currentTimeMicros();
+    vector<pair<rsb::EventPtr, rsb::EventPtr> > replacements;
+    for (vector<rsb::EventPtr>::const_iterator it = candidates.begin();
+            it != candidates.end(); ++it) {
 
-    map<boost::uint64_t, rsb::EventId>::iterator startRange =
-            deletionTimeToId.begin();
-    map<boost::uint64_t, rsb::EventId>::iterator endRange =
-            deletionTimeToId.upper_bound(now);
-    if (endRange != startRange) {
+        SerializedPayloadPtr payload = getSerializedPayload(*it);
 
-        for (map<boost::uint64_t, rsb::EventId>::iterator it = startRange;
-                it != endRange; ++it) {
-            eventMap.erase(it->second);
+        boost::shared_ptr<CompressedPayload> compressed(new CompressedPayload);
+        compressBlock(payload->second, compressed->bytes);
+        if (compressed->bytes.size() >= payload->second.size()) {
+            continue;
         }
+        compressed->wireSchema = payload->first;
+        compressed->size = payload->second.size();
+
+        // other holders of the event keep the uncompressed payload
+        rsb::EventPtr event(new rsb::Event(**it));
+        event->setType(rsc::runtime::typeName<CompressedPayload>());
+        event->setData(compressed);
+        replacements.push_back(make_pair(*it, event));
+
+    }
+
+    boost::recursive_mutex::scoped_lock lock(mapsMutex);
+    for (vector<pair<rsb::EventPtr, rsb::EventPtr> >::const_iterator it =
+            replacements.begin(); it != replacements.end(); ++it) {
+
+        // skip events which have been removed in the meantime
+        EventMap::iterator eventIt = eventMap.find(it->first->getId());
+        if (eventIt == eventMap.end() || eventIt->second != it->first) {
+            continue;
+        }
+        eventIt->second = it->second;
+
+        boost::shared_ptr<CompressedPayload> compressed =
+                boost::static_pointer_cast<CompressedPayload>(
+                        it->second->getData());
+        uncompressedBytes += compressed->size;
+        compressedBytes += compressed->bytes.size();
+
+    }
+
+}
 
-        deletionTimeToId.erase(startRange, endRange);
+rsb::EventPtr TimeBoundedBuffer::decompress(rsb::EventPtr event) {
 
+    static const string COMPRESSED_TYPE = rsc::runtime::typeName<
+            CompressedPayload>();
+    if (event->getType() != COMPRESSED_TYPE) {
+        return event;
     }
 
-    assert(eventMap.size() == deletionTimeToId.size());
+    boost::shared_ptr<CompressedPayload> compressed =
+            boost::static_pointer_cast<CompressedPayload>(event->getData());
+    SerializedPayloadPtr payload(new SerializedPayload);
+    payload->first = compressed->wireSchema;
+    decompressBlock(compressed->bytes.data(), compressed->bytes.size(),
+            compressed->size, payload->second);
+
+    rsb::EventPtr result(new rsb::Event(*event));
+    result->setType(rsc::runtime::typeName<SerializedPayload>());
+    result->setData(payload);
+    return result;
 
 }
 
@@ -26,7 +26,9 @@
 
 #pragma once
 
+#include <functional>
 #include <map>
+#include <string>
 
 #include <boost/cstdint.hpp>
 #include <boost/thread.hpp>
@@ -34,34 +36,112 @@
 #include <rsc/logging/Logger.h>
 
 #include "Buffer.h"
+#include "SlabAllocator.h"
+#include "SlabArena.h"
 
 namespace rsb {
 namespace tools {
 namespace simplebuffer {
 
 /**
+ * The nodes of both maps are allocated from a SlabArena owned by the buffer,
+ * so that nodes of expired events are reused for new ones.
+ *
+ * Optionally, the SerializedPayloads of events older than a threshold are
+ * compressed with #compressBlock in #removeOld. They are decompressed into a
+ * copy of the event whenever it is requested, so callers never see the
+ * compressed form.
+ *
  * @author jwienke
  */
 class TimeBoundedBuffer: public Buffer {
 public:
 
-    TimeBoundedBuffer(const boost::uint64_t &deltaInMuSec);
+    /**
+     * Creates a new buffer.
+     *
+     * @param deltaInMuSec time to retain events after their delivery
+     * @param expireOnInsert if @c true, old events are removed on each
+     *                       insertion. Otherwise #removeOld has to be called
+     *                       periodically, e.g. by an ExpiryTask.
+     * @param compressAfterMuSec time after the delivery of events after which
+     *                           their payloads are compressed or 0 to never
+     *                           compress them
+     */
+    TimeBoundedBuffer(const boost::uint64_t &deltaInMuSec,
+            bool expireOnInsert = true,
+            const boost::uint64_t &compressAfterMuSec = 0);
     virtual ~TimeBoundedBuffer();
 
     void insert(rsb::EventPtr event);
     rsb::EventPtr get(const rsb::EventId &id);
+    void removeOld(const boost::uint64_t &now);
+    void getRange(const rsb::Scope &scope, const boost::uint64_t &start,
+            const boost::uint64_t &end, std::vector<rsb::EventPtr> &events);
+    std::size_t size();
+
+    /**
+     * Returns the uncompressed payload bytes of all events which have been
+     * compressed.
+     *
+     * @return bytes since creation
+     */
+    boost::uint64_t getUncompressedBytes();
+
+    /**
+     * Returns the payload bytes of all events which have been compressed
+     * after compressing them.
+     *
+     * @return bytes since creation
+     */
+    boost::uint64_t getCompressedBytes();
 
 private:
 
-    void removeOld();
+    /**
+     * Payload of stored events whose SerializedPayload has been compressed.
+     */
+    struct CompressedPayload {
+        std::string wireSchema;
+        std::size_t size;
+        std::string bytes;
+    };
+
+    typedef std::pair<const rsb::EventId, rsb::EventPtr> EventMapValue;
+    typedef std::map<rsb::EventId, rsb::EventPtr, std::less<rsb::EventId>,
+            SlabAllocator<EventMapValue> > EventMap;
+    typedef std::pair<const boost::uint64_t, rsb::EventId> DeletionTimeMapValue;
+    typedef std::multimap<boost::uint64_t, rsb::EventId,
+            std::less<boost::uint64_t>, SlabAllocator<DeletionTimeMapValue> > DeletionTimeMap;
+
+    /**
+     * Compresses the payloads of all events whose deletion time lies before
+     * @a limit. Has to be called without holding #mapsMutex.
+     */
+    void compress(const boost::uint64_t &limit);
+    static rsb::EventPtr decompress(rsb::EventPtr event);
 
     rsc::logging::LoggerPtr logger;
 
     boost::uint64_t deltaInMuSec;
+    bool expireOnInsert;
+    boost::uint64_t compressAfterMuSec;
 
     boost::recursive_mutex mapsMutex;
-    std::map<rsb::EventId, rsb::EventPtr> eventMap;
-    std::multimap<boost::uint64_t, rsb::EventId> deletionTimeToId;
+
+    /**
+     * Must be declared before the maps to outlive them.
+     */
+    SlabArena arena;
+    EventMap eventMap;
+    DeletionTimeMap deletionTimeToId;
+
+    /**
+     * Deletion time up to which events have been considered for compression.
+     */
+    boost::uint64_t compressedUntil;
+    boost::uint64_t uncompressedBytes;
+    boost::uint64_t compressedBytes;
 
 };
 
@@ -0,0 +1,155 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "TimeIndexedBuffer.h"
+
+#include <algorithm>
+#include <limits>
+
+#include <rsb/MetaData.h>
+
+using namespace std;
+using namespace rsb::tools::timesync;
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+TimeIndexedBuffer::TimeIndexedBuffer(BufferPtr buffer,
+        TimestampSelectorPtr selector, const boost::uint64_t &deltaInMuSec) :
+        logger(rsc::logging::Logger::getLogger("rsbbuffer.TimeIndexedBuffer")), buffer(
+                buffer), selector(selector), deltaInMuSec(deltaInMuSec), latestDeletionTime(
+                0) {
+}
+
+TimeIndexedBuffer::~TimeIndexedBuffer() {
+}
+
+void TimeIndexedBuffer::insert(rsb::EventPtr event) {
+
+    buffer->insert(event);
+
+    boost::uint64_t timestamp;
+    try {
+        timestamp = selector->getTimestamp(event);
+    } catch (const TimestampSelector::NoSuchTimestampException &e) {
+        RSCTRACE(logger,
+                "Not indexing event " << event->getId() << ": " << e.what());
+        return;
+    }
+
+    boost::mutex::scoped_lock lock(mutex);
+
+    latestDeletionTime = max(latestDeletionTime,
+            event->getMetaData().getDeliverTime() + deltaInMuSec);
+    removeExpired(latestDeletionTime - deltaInMuSec);
+
+    IndexEntry entry;
+    entry.deletionTime = latestDeletionTime;
+    entry.index = &indices[*event->getScopePtr()];
+    entry.position = entry.index->insert(make_pair(timestamp, event->getId()));
+    entries.push_back(entry);
+
+}
+
+rsb::EventPtr TimeIndexedBuffer::get(const rsb::EventId &id) {
+    return buffer->get(id);
+}
+
+void TimeIndexedBuffer::removeOld(const boost::uint64_t &now) {
+    buffer->removeOld(now);
+    boost::mutex::scoped_lock lock(mutex);
+    removeExpired(now);
+}
+
+void TimeIndexedBuffer::getRange(const rsb::Scope &scope,
+        const boost::uint64_t &start, const boost::uint64_t &end,
+        vector<rsb::EventPtr> &events) {
+    buffer->getRange(scope, start, end, events);
+}
+
+size_t TimeIndexedBuffer::size() {
+    return buffer->size();
+}
+
+rsb::EventPtr TimeIndexedBuffer::getNearest(const rsb::Scope &scope,
+        const boost::uint64_t &time) {
+    boost::mutex::scoped_lock lock(mutex);
+
+    rsb::EventPtr best;
+    boost::uint64_t bestDistance = numeric_limits<boost::uint64_t>::max();
+    for (map<rsb::Scope, TimeIndex>::const_iterator it = indices.begin();
+            it != indices.end(); ++it) {
+        if (it->first == scope || scope.isSuperScopeOf(it->first)) {
+            findNearest(it->second, time, best, bestDistance);
+        }
+    }
+    return best;
+}
+
+void TimeIndexedBuffer::findNearest(const TimeIndex &index,
+        const boost::uint64_t &time, rsb::EventPtr &best,
+        boost::uint64_t &bestDistance) {
+
+    TimeIndex::const_iterator split = index.lower_bound(time);
+
+    for (TimeIndex::const_iterator it = split; it != index.end(); ++it) {
+        if (it->first - time >= bestDistance) {
+            break;
+        }
+        rsb::EventPtr event = buffer->get(it->second);
+        if (event) {
+            best = event;
+            bestDistance = it->first - time;
+            break;
+        }
+    }
+
+    for (TimeIndex::const_iterator it = split; it != index.begin();) {
+        --it;
+        if (time - it->first >= bestDistance) {
+            break;
+        }
+        rsb::EventPtr event = buffer->get(it->second);
+        if (event) {
+            best = event;
+            bestDistance = time - it->first;
+            break;
+        }
+    }
+
+}
+
+void TimeIndexedBuffer::removeExpired(const boost::uint64_t &now) {
+    while (!entries.empty() && entries.front().deletionTime <= now) {
+        entries.front().index->erase(entries.front().position);
+        entries.pop_front();
+    }
+}
+
+}
+}
+}
@@ -0,0 +1,132 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <deque>
+#include <map>
+
+#include <boost/cstdint.hpp>
+#include <boost/thread.hpp>
+
+#include <rsc/logging/Logger.h>
+
+#include <rsb/EventId.h>
+#include <rsb/Scope.h>
+
+#include <rsb/tools/timesync/TimestampSelector.h>
+
+#include "Buffer.h"
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * A decorator which maintains a time sorted index per scope for the events
+ * stored in another buffer. The indexed timestamp is chosen by a
+ * TimestampSelector and may thus also be a user time. Events without the
+ * selected timestamp are stored but not indexed.
+ *
+ * Index entries are dropped once the retention time after the delivery of
+ * their event has passed. Events which the decorated buffer removed earlier
+ * are skipped in queries.
+ */
+class TimeIndexedBuffer: public Buffer {
+public:
+
+    /**
+     * Creates a new decorator.
+     *
+     * @param buffer the buffer to index
+     * @param selector selects the timestamp to index events by
+     * @param deltaInMuSec time to keep index entries after the delivery of
+     *                     their event. Should be the longest retention time
+     *                     of @a buffer.
+     */
+    TimeIndexedBuffer(BufferPtr buffer,
+            rsb::tools::timesync::TimestampSelectorPtr selector,
+            const boost::uint64_t &deltaInMuSec);
+    virtual ~TimeIndexedBuffer();
+
+    void insert(rsb::EventPtr event);
+    rsb::EventPtr get(const rsb::EventId &id);
+    void removeOld(const boost::uint64_t &now);
+    void getRange(const rsb::Scope &scope, const boost::uint64_t &start,
+            const boost::uint64_t &end, std::vector<rsb::EventPtr> &events);
+    std::size_t size();
+
+    /**
+     * Returns the stored event on a scope or one of its sub-scopes whose
+     * indexed timestamp is closest to the given time.
+     *
+     * @param scope scope of the requested event
+     * @param time point in time in microseconds
+     * @return the closest event or an empty pointer if there is none
+     */
+    rsb::EventPtr getNearest(const rsb::Scope &scope,
+            const boost::uint64_t &time);
+
+private:
+
+    typedef std::multimap<boost::uint64_t, rsb::EventId> TimeIndex;
+
+    struct IndexEntry {
+        boost::uint64_t deletionTime;
+        TimeIndex *index;
+        TimeIndex::iterator position;
+    };
+
+    /**
+     * Considers the closest events of an index below and above @a time.
+     */
+    void findNearest(const TimeIndex &index, const boost::uint64_t &time,
+            rsb::EventPtr &best, boost::uint64_t &bestDistance);
+
+    void removeExpired(const boost::uint64_t &now);
+
+    rsc::logging::LoggerPtr logger;
+
+    BufferPtr buffer;
+    rsb::tools::timesync::TimestampSelectorPtr selector;
+    boost::uint64_t deltaInMuSec;
+
+    boost::mutex mutex;
+    std::map<rsb::Scope, TimeIndex> indices;
+
+    /**
+     * Index entries in insertion order with monotonic deletion times.
+     */
+    std::deque<IndexEntry> entries;
+    boost::uint64_t latestDeletionTime;
+
+};
+
+typedef boost::shared_ptr<TimeIndexedBuffer> TimeIndexedBufferPtr;
+
+}
+}
+}
@@ -0,0 +1,84 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "TimePointConverter.h"
+
+#include <stdexcept>
+
+#include <rsc/runtime/TypeStringTools.h>
+
+#include <rsb/converter/SerializationException.h>
+
+#include "BinaryEncoding.h"
+#include "TimePoint.h"
+
+using namespace std;
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+const string TimePointConverter::WIRE_SCHEMA = "rsb-buffer-time-point";
+
+TimePointConverter::TimePointConverter() :
+        rsb::converter::Converter<string>(
+                rsc::runtime::typeName<TimePoint>(), WIRE_SCHEMA, true) {
+}
+
+TimePointConverter::~TimePointConverter() {
+}
+
+string TimePointConverter::serialize(const rsb::AnnotatedData &data,
+        string &wire) {
+    assert(data.first == getDataType());
+
+    boost::shared_ptr<TimePoint> point = boost::static_pointer_cast<
+            TimePoint>(data.second);
+    wire.clear();
+    writeUint64(wire, point->getTime());
+    wire.append(point->getScope().toString());
+    return getWireSchema();
+}
+
+rsb::AnnotatedData TimePointConverter::deserialize(const string &wireSchema,
+        const string &wire) {
+    assert(wireSchema == getWireSchema());
+
+    try {
+        size_t offset = 0;
+        boost::uint64_t time = readUint64(wire, offset);
+        return make_pair(getDataType(),
+                TimePointPtr(
+                        new TimePoint(rsb::Scope(wire.substr(offset)), time)));
+    } catch (const exception &e) {
+        throw rsb::converter::SerializationException(
+                string("Invalid time point: ") + e.what());
+    }
+}
+
+}
+}
+}
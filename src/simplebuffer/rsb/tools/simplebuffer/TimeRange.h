@@ -0,0 +1,72 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <boost/cstdint.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <rsb/Scope.h>
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+/**
+ * Request for all buffered events on a scope delivered in a time interval.
+ */
+class TimeRange {
+public:
+
+    /**
+     * Creates a new request.
+     *
+     * @param scope scope of the requested events. Events on sub-scopes are
+     *              included.
+     * @param start earliest deliver time in microseconds, inclusive
+     * @param end latest deliver time in microseconds, inclusive
+     */
+    TimeRange(const rsb::Scope &scope, const boost::uint64_t &start,
+            const boost::uint64_t &end);
+    virtual ~TimeRange();
+
+    rsb::Scope getScope() const;
+    boost::uint64_t getStart() const;
+    boost::uint64_t getEnd() const;
+
+private:
+
+    rsb::Scope scope;
+    boost::uint64_t start;
+    boost::uint64_t end;
+
+};
+
+typedef boost::shared_ptr<TimeRange> TimeRangePtr;
+
+}
+}
+}
@@ -0,0 +1,87 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "TimeRangeConverter.h"
+
+#include <stdexcept>
+
+#include <rsc/runtime/TypeStringTools.h>
+
+#include <rsb/converter/SerializationException.h>
+
+#include "BinaryEncoding.h"
+#include "TimeRange.h"
+
+using namespace std;
+
+namespace rsb {
+namespace tools {
+namespace simplebuffer {
+
+const string TimeRangeConverter::WIRE_SCHEMA = "rsb-buffer-time-range";
+
+TimeRangeConverter::TimeRangeConverter() :
+        rsb::converter::Converter<string>(
+                rsc::runtime::typeName<TimeRange>(), WIRE_SCHEMA, true) {
+}
+
+TimeRangeConverter::~TimeRangeConverter() {
+}
+
+string TimeRangeConverter::serialize(const rsb::AnnotatedData &data,
+        string &wire) {
+    assert(data.first == getDataType());
+
+    boost::shared_ptr<TimeRange> range = boost::static_pointer_cast<
+            TimeRange>(data.second);
+    wire.clear();
+    writeUint64(wire, range->getStart());
+    writeUint64(wire, range->getEnd());
+    wire.append(range->getScope().toString());
+    return getWireSchema();
+}
+
+rsb::AnnotatedData TimeRangeConverter::deserialize(const string &wireSchema,
+        const string &wire) {
+    assert(wireSchema == getWireSchema());
+
+    try {
+        size_t offset = 0;
+        boost::uint64_t start = readUint64(wire, offset);
+        boost::uint64_t end = readUint64(wire, offset);
+        return make_pair(getDataType(),
+                TimeRangePtr(
+                        new TimeRange(rsb::Scope(wire.substr(offset)), start,
+                                end)));
+    } catch (const exception &e) {
+        throw rsb::converter::SerializationException(
+                string("Invalid time range: ") + e.what());
+    }
+}
+
+}
+}
+}
@@ -24,24 +24,34 @@
  *
  * ============================================================ */
 
+#include <algorithm>
+#include <fstream>
 #include <iostream>
 #include <map>
 #include <set>
+#include <stdexcept>
 #include <string>
 
 #include <stdlib.h>
 
+#include <boost/algorithm/string.hpp>
 #include <boost/program_options.hpp>
 
 #include <rsc/misc/SignalWaiter.h>
+#include <rsc/misc/langutils.h>
+
+#include <rsc/threading/ThreadedTaskExecutor.h>
 
 #include <rsb/Factory.h>
+#include <rsb/Informer.h>
 #include <rsb/Listener.h>
 #include <rsb/Scope.h>
 
 #include <rsb/converter/ConverterSelectionStrategy.h>
 #include <rsb/converter/EventIdConverter.h>
+#include <rsb/converter/EventsByScopeMapConverter.h>
 #include <rsb/converter/PredicateConverterList.h>
+#include <rsb/converter/Repository.h>
 #include <rsb/converter/SchemaAndByteArrayConverter.h>
 #include <rsb/converter/TypeNameConverterPredicate.h>
 #include <rsb/converter/VoidConverter.h>
@@ -51,10 +61,37 @@
 #include <rsc/logging/Logger.h>
 #include <rsc/logging/LoggerFactory.h>
 
+#include <rsb/tools/timesync/PriorityTimestampSelector.h>
+#include <rsb/tools/timesync/StaticTimestampSelectors.h>
+
+#include "BatchRequestCallback.h"
+#include "BloomFilteredBuffer.h"
 #include "Buffer.h"
 #include "BufferInsertHandler.h"
 #include "BufferRequestCallback.h"
+#include "CoalescingGetHandler.h"
+#include "ConcurrentReadBuffer.h"
+#include "DeduplicatingBuffer.h"
+#include "EventIdListConverter.h"
+#include "ExpiryTask.h"
+#include "InstrumentedBuffer.h"
+#include "NearestRequestCallback.h"
+#include "RangeRequestCallback.h"
+#include "ReplayRequestConverter.h"
+#include "RingBuffer.h"
+#include "ScopeRetention.h"
+#include "ScopedBuffer.h"
+#include "ShardedBuffer.h"
+#include "Snapshot.h"
+#include "SpillingBuffer.h"
+#include "StatisticsTask.h"
+#include "StreamingBuffer.h"
+#include "SubscribeRequestCallback.h"
 #include "TimeBoundedBuffer.h"
+#include "TimeIndexedBuffer.h"
+#include "TimePointConverter.h"
+#include "TimeRangeConverter.h"
+#include "UnsubscribeRequestCallback.h"
 
 using namespace std;
 using namespace boost::program_options;
@@ -62,25 +99,97 @@ using namespace rsb;
 using namespace rsb::converter;
 using namespace rsb::patterns;
 using namespace rsb::tools::simplebuffer;
+using namespace rsb::tools::timesync;
+
+rsc::logging::LoggerPtr logger = rsc::logging::Logger::getLogger("rsbbuffer");
 
 set<Scope> scopes;
+vector<ScopeRetention> scopeRetentions;
 map<Scope, ListenerPtr> listenersByScope;
 Scope bufferScope;
 boost::uint64_t bufferTimeMuSec = 2000000;
+string bufferImplementation = "ring";
+unsigned int numShards = 1;
+unsigned int expiryPeriodMs = 100;
+boost::uint64_t maxBytes = 0;
+string spillDirectory;
+boost::uint64_t hotTimeMuSec = 2000000;
+boost::uint64_t segmentBytes = 64 * 1024 * 1024;
+string statisticsScopeName;
+unsigned int statisticsPeriodMs = 1000;
+TimestampSelectorPtr indexTimestampSelector;
+string snapshotFile;
+bool deduplicate = false;
+bool subscriptions = false;
+boost::uint64_t compressAfterMuSec = 0;
+unsigned int rpcWorkers = 0;
+size_t rpcQueueSize = 1024;
+size_t bloomFilterEvents = 0;
+
+vector<boost::shared_ptr<RingBuffer> > ringBuffers;
+
+TimestampSelectorPtr createSelectorFromName(const string &name) {
+    if (name == TimestampSelector::CREATE) {
+        return TimestampSelectorPtr(new CreateTimestampSelector);
+    } else if (name == TimestampSelector::SEND) {
+        return TimestampSelectorPtr(new SendTimestampSelector);
+    } else if (name == TimestampSelector::RECEIVE) {
+        return TimestampSelectorPtr(new ReceiveTimestampSelector);
+    } else if (name == TimestampSelector::DELIVER) {
+        return TimestampSelectorPtr(new DeliverTimestampSelector);
+    } else {
+        return TimestampSelectorPtr(new UserTimestampSelector(name));
+    }
+}
 
 void handleCommandline(int argc, char *argv[]) {
 
     vector<string> scopeNames;
     string bufferScopeName;
+    string indexTimestampNames;
 
     options_description options("Allowed options");
     options.add_options()("help,h", "Display a help message.")("scope,s",
             value<vector<string> >(&scopeNames),
-            "Adds a scope to subscribe on.")("bufferscope,b",
+            "Adds a scope to subscribe on. Optionally, the retention time and byte limit for events on this scope can be specified as SCOPE[:TIME[:BYTES]] with TIME in us, ms, s or min and BYTES with an optional K, M or G suffix, e.g. /camera:500ms:512M.")("bufferscope,b",
             value<string>(&bufferScopeName),
             "The scope this buffer is available on with its RPC interface.")(
             "time,t", value<boost::uint64_t>(&bufferTimeMuSec),
-            "The time to retain elements in the buffer in musec");
+            "The time to retain elements in the buffer in musec")(
+            "implementation,i", value<string>(&bufferImplementation),
+            "The buffer implementation to use: 'ring' (default), 'map' or 'concurrent' for lookups which never block inserts.")(
+            "shards,n", value<unsigned int>(&numShards),
+            "Number of independently locked buffers to distribute events over. Use one per subscribed scope to scale ingestion across cores.")(
+            "expiry-period,e", value<unsigned int>(&expiryPeriodMs),
+            "Interval in ms in which old elements are removed in the background. 0 removes them on each insertion instead.")(
+            "max-bytes,m", value<boost::uint64_t>(&maxBytes),
+            "Maximum number of serialized payload bytes to retain. The oldest elements are evicted early if required. Only supported by the ring implementation. 0 means no limit.")(
+            "spill-directory,d", value<string>(&spillDirectory),
+            "Existing directory to move elements to which are older than --hot-time. Elements are kept in memory only if not specified.")(
+            "hot-time,w", value<boost::uint64_t>(&hotTimeMuSec),
+            "The time to retain elements in memory before moving them to the spill directory in musec.")(
+            "segment-size", value<boost::uint64_t>(&segmentBytes),
+            "Bytes of elements to store in each file in the spill directory.")(
+            "statistics-scope", value<string>(&statisticsScopeName),
+            "Scope to periodically publish buffer statistics on as strings, e.g. to watch them with the logger. Statistics are not collected if not specified.")(
+            "statistics-period", value<unsigned int>(&statisticsPeriodMs),
+            "Interval in ms in which statistics are published.")(
+            "rpc-workers", value<unsigned int>(&rpcWorkers),
+            "Number of threads answering get requests. Concurrent requests for the same event are answered with a single lookup. 0 answers them one after another on the thread dispatching the requests.")(
+            "rpc-queue-size", value<size_t>(&rpcQueueSize),
+            "Number of distinct get requests which may wait for an RPC worker before further requests are delayed.")(
+            "compress-after", value<boost::uint64_t>(&compressAfterMuSec),
+            "Time in musec after which the payloads of buffered elements are compressed to retain more of them in the same memory. Only supported by the map implementation. 0 disables compression.")(
+            "subscriptions",
+            "Allow clients to subscribe to the buffered elements from a point in time on and to receive newly arriving elements afterwards using the subscribe and unsubscribe methods.")(
+            "deduplicate",
+            "Store identical payloads of different events only once. Useful for producers which repeatedly send the same data.")(
+            "bloom-filter", value<size_t>(&bloomFilterEvents),
+            "Answer get requests for unknown or long expired elements from a Bloom filter without accessing the buffer. The value is the number of elements expected within half of the retention time. 0 disables the filter.")(
+            "snapshot", value<string>(&snapshotFile),
+            "File to write the buffered events to on shutdown. If the file exists on startup, the events from it which are not expired yet are buffered again.")(
+            "index-timestamp", value<string>(&indexTimestampNames),
+            "Comma-separated priority list of timestamps to index events by for the getNearest method. Either one of create, send, receive, deliver or the name of a user time. Events without any of these timestamps are not indexed. getNearest is not available if not specified.");
 
     variables_map map;
     store(command_line_parser(argc, argv).options(options).run(), map);
@@ -91,6 +200,9 @@ void handleCommandline(int argc, char *argv[]) {
         exit(EXIT_SUCCESS);
     }
 
+    deduplicate = map.count("deduplicate") > 0;
+    subscriptions = map.count("subscriptions") > 0;
+
     // validity checks
 
     if (scopeNames.empty()) {
@@ -99,7 +211,15 @@ void handleCommandline(int argc, char *argv[]) {
     }
     for (vector<string>::const_iterator scopeIt = scopeNames.begin();
             scopeIt != scopeNames.end(); ++scopeIt) {
-        scopes.insert(*scopeIt);
+        try {
+            scopeRetentions.push_back(
+                    ScopeRetention::parse(*scopeIt, bufferTimeMuSec,
+                            maxBytes));
+        } catch (const invalid_argument &e) {
+            cerr << "Invalid scope " << *scopeIt << ": " << e.what() << endl;
+            exit(1);
+        }
+        scopes.insert(scopeRetentions.back().getScope());
     }
 
     if (bufferScopeName.empty()) {
@@ -109,9 +229,163 @@ void handleCommandline(int argc, char *argv[]) {
     }
     bufferScope = bufferScopeName;
 
+    if (bufferImplementation != "ring" && bufferImplementation != "map"
+            && bufferImplementation != "concurrent") {
+        cerr << "Unknown buffer implementation " << bufferImplementation
+                << endl;
+        exit(1);
+    }
+
+    for (vector<ScopeRetention>::const_iterator it = scopeRetentions.begin();
+            it != scopeRetentions.end(); ++it) {
+        if (it->getMaxBytes() > 0 && bufferImplementation != "ring") {
+            cerr << "A byte limit is only supported by the ring implementation."
+                    << endl;
+            exit(1);
+        }
+    }
+
+    if (numShards == 0) {
+        cerr << "At least one shard is required." << endl;
+        exit(1);
+    }
+
+    if (!statisticsScopeName.empty() && statisticsPeriodMs == 0) {
+        cerr << "The statistics period must be greater than 0." << endl;
+        exit(1);
+    }
+
+    if (compressAfterMuSec > 0 && bufferImplementation != "map") {
+        cerr << "Compression is only supported by the map implementation."
+                << endl;
+        exit(1);
+    }
+
+    if (rpcWorkers > 0 && rpcQueueSize == 0) {
+        cerr << "The RPC queue size must be greater than 0." << endl;
+        exit(1);
+    }
+
+    if (!spillDirectory.empty() && hotTimeMuSec > bufferTimeMuSec) {
+        cerr << "The hot time must not exceed the buffer time." << endl;
+        exit(1);
+    }
+
+    if (!indexTimestampNames.empty()) {
+        vector<string> names;
+        boost::algorithm::split(names, indexTimestampNames,
+                boost::algorithm::is_any_of(","),
+                boost::algorithm::token_compress_on);
+        vector<TimestampSelectorPtr> selectors;
+        for (vector<string>::const_iterator nameIt = names.begin();
+                nameIt != names.end(); ++nameIt) {
+            if (!nameIt->empty()) {
+                selectors.push_back(createSelectorFromName(*nameIt));
+            }
+        }
+        if (selectors.empty()) {
+            cerr << "No valid timestamps specified to index." << endl;
+            exit(1);
+        }
+        if (selectors.size() == 1) {
+            indexTimestampSelector = selectors.front();
+        } else {
+            indexTimestampSelector.reset(
+                    new PriorityTimestampSelector(selectors));
+        }
+    }
+
+}
+
+BufferPtr createSingleBuffer(const boost::uint64_t &timeMuSec,
+        const boost::uint64_t &byteBudget) {
+    if (bufferImplementation == "map") {
+        // a spilling buffer expires its hot buffer by itself
+        return BufferPtr(
+                new TimeBoundedBuffer(timeMuSec,
+                        expiryPeriodMs == 0 && spillDirectory.empty(),
+                        compressAfterMuSec));
+    } else if (bufferImplementation == "concurrent") {
+        return BufferPtr(new ConcurrentReadBuffer(timeMuSec));
+    } else {
+        // 0 means unlimited, hence a small budget must not be divided to 0
+        boost::uint64_t shardBudget = 0;
+        if (byteBudget > 0) {
+            shardBudget = max<boost::uint64_t>(1, byteBudget / numShards);
+        }
+        boost::shared_ptr<RingBuffer> ring(
+                new RingBuffer(timeMuSec, 1024, shardBudget));
+        ringBuffers.push_back(ring);
+        return ring;
+    }
+}
+
+BufferPtr createMemoryBuffer(const boost::uint64_t &timeMuSec,
+        const boost::uint64_t &byteBudget) {
+    if (numShards == 1) {
+        return createSingleBuffer(timeMuSec, byteBudget);
+    }
+    vector<BufferPtr> shards;
+    for (unsigned int i = 0; i < numShards; ++i) {
+        shards.push_back(createSingleBuffer(timeMuSec, byteBudget));
+    }
+    return BufferPtr(new ShardedBuffer(shards));
+}
+
+BufferPtr createRetainingBuffer(const ScopeRetention &retention) {
+    if (spillDirectory.empty()) {
+        return createMemoryBuffer(retention.getTimeMuSec(),
+                retention.getMaxBytes());
+    }
+    boost::uint64_t hotTime = min(hotTimeMuSec, retention.getTimeMuSec());
+    return BufferPtr(
+            new SpillingBuffer(
+                    createMemoryBuffer(hotTime, retention.getMaxBytes()),
+                    hotTime, retention.getTimeMuSec(), spillDirectory,
+                    segmentBytes));
+}
+
+boost::uint64_t getMaxRetentionTime() {
+    boost::uint64_t maxTimeMuSec = bufferTimeMuSec;
+    for (vector<ScopeRetention>::const_iterator it = scopeRetentions.begin();
+            it != scopeRetentions.end(); ++it) {
+        maxTimeMuSec = max(maxTimeMuSec, it->getTimeMuSec());
+    }
+    return maxTimeMuSec;
 }
 
-ParticipantConfig getNoConversionConfig() {
+BufferPtr createBuffer() {
+
+    bool sameRetention = true;
+    for (vector<ScopeRetention>::const_iterator it = scopeRetentions.begin();
+            it != scopeRetentions.end(); ++it) {
+        sameRetention = sameRetention
+                && it->getTimeMuSec() == bufferTimeMuSec
+                && it->getMaxBytes() == maxBytes;
+    }
+    if (sameRetention) {
+        return createRetainingBuffer(
+                ScopeRetention(Scope("/"), bufferTimeMuSec, maxBytes));
+    }
+
+    map<Scope, BufferPtr> buffers;
+    for (vector<ScopeRetention>::const_iterator it = scopeRetentions.begin();
+            it != scopeRetentions.end(); ++it) {
+        RSCINFO(logger,
+                "Retaining events on " << it->getScope() << " for " << it->getTimeMuSec() << " musec with a limit of " << it->getMaxBytes() << " bytes");
+        buffers[it->getScope()] = createRetainingBuffer(*it);
+    }
+    return BufferPtr(new ScopedBuffer(buffers));
+
+}
+
+/**
+ * Creates a participant config which passes payloads through unconverted.
+ *
+ * @param withCollections if @c true, EventsByScopeMap payloads are converted
+ *                        with unconverted payloads of their contained events
+ */
+ParticipantConfig getNoConversionConfig(bool withCollections = false) {
 
     // set up converters
     list<pair<ConverterPredicatePtr, Converter<string>::Ptr> > converters;
@@ -124,6 +398,20 @@ ParticipantConfig getNoConversionConfig() {
     ConverterSelectionStrategy<string>::Ptr noConversionSelectionStrategy(
             new PredicateConverterList<string>(converters.begin(),
                     converters.end()));
+    if (withCollections) {
+        Converter<string>::Ptr collectionConverter(
+                new EventsByScopeMapConverter(noConversionSelectionStrategy,
+                        noConversionSelectionStrategy));
+        converters.push_front(
+                make_pair(
+                        ConverterPredicatePtr(
+                                new TypeNameConverterPredicate(
+                                        collectionConverter->getDataType())),
+                        collectionConverter));
+        noConversionSelectionStrategy.reset(
+                new PredicateConverterList<string>(converters.begin(),
+                        converters.end()));
+    }
     // adapt default participant configuration
     ParticipantConfig config =
             getFactory().getDefaultParticipantConfig();
@@ -153,7 +441,53 @@ int main(int argc, char **argv) {
     // configure rsb for no conversion at all
     ParticipantConfig noConversionConfig = getNoConversionConfig();
 
-    BufferPtr buffer(new TimeBoundedBuffer(bufferTimeMuSec));
+    BufferPtr buffer = createBuffer();
+    DeduplicatingBufferPtr deduplicatingBuffer;
+    if (deduplicate) {
+        deduplicatingBuffer.reset(new DeduplicatingBuffer(buffer));
+        buffer = deduplicatingBuffer;
+    }
+    TimeIndexedBufferPtr indexedBuffer;
+    if (indexTimestampSelector) {
+        indexedBuffer.reset(
+                new TimeIndexedBuffer(buffer, indexTimestampSelector,
+                        getMaxRetentionTime()));
+        buffer = indexedBuffer;
+    }
+    StreamingBufferPtr streamingBuffer;
+    if (subscriptions) {
+        streamingBuffer.reset(
+                new StreamingBuffer(buffer, noConversionConfig, scopes));
+        buffer = streamingBuffer;
+    }
+    BloomFilteredBufferPtr filteredBuffer;
+    if (bloomFilterEvents > 0) {
+        filteredBuffer.reset(
+                new BloomFilteredBuffer(buffer, getMaxRetentionTime(),
+                        bloomFilterEvents));
+        buffer = filteredBuffer;
+    }
+
+    if (!snapshotFile.empty() && ifstream(snapshotFile.c_str()).good()) {
+        boost::uint64_t now = rsc::misc::currentTimeMicros();
+        boost::uint64_t maxTimeMuSec = getMaxRetentionTime();
+        try {
+            size_t loaded = loadSnapshot(snapshotFile, buffer,
+                    now > maxTimeMuSec ? now - maxTimeMuSec : 0);
+            buffer->removeOld(now);
+            RSCINFO(logger,
+                    "Restored " << loaded << " events from " << snapshotFile);
+        } catch (const runtime_error &e) {
+            RSCERROR(logger,
+                    "Could not restore snapshot: " << e.what());
+        }
+    }
+
+    InstrumentedBufferPtr instrumentedBuffer;
+    if (!statisticsScopeName.empty()) {
+        instrumentedBuffer.reset(new InstrumentedBuffer(buffer));
+        buffer = instrumentedBuffer;
+    }
 
     // set up listeners for the buffer
     for (set<Scope>::const_iterator scopeIt = scopes.begin();
@@ -165,13 +499,124 @@ int main(int argc, char **argv) {
     }
 
     // make buffer available over RPC
+    converterRepository<string>()->registerConverter(
+            Converter<string>::Ptr(new TimeRangeConverter));
+    converterRepository<string>()->registerConverter(
+            Converter<string>::Ptr(new EventIdListConverter));
+    converterRepository<string>()->registerConverter(
+            Converter<string>::Ptr(new TimePointConverter));
+    converterRepository<string>()->registerConverter(
+            Converter<string>::Ptr(new ReplayRequestConverter));
     LocalServerPtr server = getFactory()
         .createLocalServer(bufferScope,
                            getFactory().getDefaultParticipantConfig(),
-                           noConversionConfig);
-    server->registerMethod("get",
-                           LocalServer::CallbackPtr(new BufferRequestCallback(buffer)));
+                           getNoConversionConfig(true));
+    ListenerPtr getListener;
+    boost::shared_ptr<CoalescingGetHandler> getHandler;
+    if (rpcWorkers > 0) {
+        // answer get requests like the server would, but on a worker pool
+        Scope getScope = bufferScope.concat(Scope("/get"));
+        getHandler.reset(
+                new CoalescingGetHandler(buffer,
+                        getFactory().createInformerBase(getScope, "",
+                                getNoConversionConfig(true)), rpcWorkers,
+                        rpcQueueSize));
+        getListener = getFactory().createListener(getScope);
+        getListener->addHandler(getHandler, true);
+    } else {
+        server->registerMethod("get",
+                               LocalServer::CallbackPtr(new BufferRequestCallback(buffer)));
+    }
+    server->registerMethod("getRange",
+                           LocalServer::CallbackPtr(new RangeRequestCallback(buffer)));
+    server->registerMethod("getMany",
+                           LocalServer::CallbackPtr(new BatchRequestCallback(buffer)));
+    if (streamingBuffer) {
+        server->registerMethod("subscribe",
+                               LocalServer::CallbackPtr(new SubscribeRequestCallback(streamingBuffer)));
+        server->registerMethod("unsubscribe",
+                               LocalServer::CallbackPtr(new UnsubscribeRequestCallback(streamingBuffer)));
+    }
+    if (indexedBuffer) {
+        server->registerMethod("getNearest",
+                               LocalServer::CallbackPtr(new NearestRequestCallback(indexedBuffer)));
+    }
+
+    // expire old elements also while no events arrive
+    rsc::threading::TaskExecutorPtr executor(
+            new rsc::threading::ThreadedTaskExecutor);
+    rsc::threading::TaskPtr expiryTask;
+    if (expiryPeriodMs > 0) {
+        expiryTask.reset(new ExpiryTask(buffer, expiryPeriodMs));
+        executor->schedule(expiryTask);
+    }
+    rsc::threading::TaskPtr statisticsTask;
+    if (instrumentedBuffer) {
+        statisticsTask.reset(
+                new StatisticsTask(instrumentedBuffer,
+                        getFactory().createInformer<string>(
+                                Scope(statisticsScopeName)),
+                        statisticsPeriodMs));
+        executor->schedule(statisticsTask);
+    }
+
+    rsc::misc::Signal signal = rsc::misc::waitForSignal();
+
+    if (expiryTask) {
+        expiryTask->cancel();
+        expiryTask->waitDone();
+    }
+    if (statisticsTask) {
+        statisticsTask->cancel();
+        statisticsTask->waitDone();
+    }
+
+    if (getHandler) {
+        getListener->removeHandler(getHandler, true);
+        RSCINFO(logger,
+                "Coalesced " << getHandler->getCoalescedRequests() << " get requests");
+        getHandler.reset();
+    }
+
+    if (!snapshotFile.empty()) {
+        // stop buffering new events so the snapshot is consistent
+        listenersByScope.clear();
+        try {
+            size_t saved = saveSnapshot(buffer, snapshotFile);
+            RSCINFO(logger,
+                    "Saved " << saved << " events to " << snapshotFile);
+        } catch (const runtime_error &e) {
+            RSCERROR(logger, "Could not save snapshot: " << e.what());
+        }
+    }
+
+    if (deduplicatingBuffer) {
+        RSCINFO(logger,
+                "Stored " << deduplicatingBuffer->getCopiedBytes() << " of " << deduplicatingBuffer->getInsertedBytes() << " payload bytes, deduplication ratio " << deduplicatingBuffer->getDeduplicationRatio());
+    }
+
+    if (filteredBuffer) {
+        RSCINFO(logger,
+                "Answered " << filteredBuffer->getFilteredMisses() << " get requests for unknown events from the Bloom filter, " << filteredBuffer->getUnfilteredMisses() << " reached the buffer");
+    }
+
+    bool byteLimited = false;
+    for (vector<ScopeRetention>::const_iterator it = scopeRetentions.begin();
+            it != scopeRetentions.end(); ++it) {
+        byteLimited = byteLimited || it->getMaxBytes() > 0;
+    }
+    if (byteLimited) {
+        boost::uint64_t evictedEvents = 0;
+        boost::uint64_t evictedBytes = 0;
+        for (vector<boost::shared_ptr<RingBuffer> >::const_iterator it =
+                ringBuffers.begin(); it != ringBuffers.end(); ++it) {
+            evictedEvents += (*it)->getEvictedEvents();
+            evictedBytes += (*it)->getEvictedBytes();
+        }
+        RSCINFO(logger,
+                "Evicted " << evictedEvents << " events with " << evictedBytes << " bytes to stay within the byte limits");
+    }
 
-    return rsc::misc::suggestedExitCode(rsc::misc::waitForSignal());
+    return rsc::misc::suggestedExitCode(signal);
 
 }
@@ -0,0 +1,139 @@
+/* ============================================================
+ *
+ * This file is part of the RSB project
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include <sstream>
+#include <vector>
+
+#include <boost/thread.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "rsb/tools/logger/AsyncFormattingHandler.h"
+
+using namespace std;
+using namespace testing;
+using namespace rsb;
+using namespace rsb::tools::logger;
+
+namespace {
+
+/**
+ * Records the sequence numbers of formatted events and blocks on
+ * each event until it is released.
+ */
+class BlockingFormatter: public EventFormatter {
+public:
+
+    BlockingFormatter():
+        released(0) {
+    }
+
+    void format(ostream &/*stream*/, EventPtr event) {
+        boost::mutex::scoped_lock lock(this->mutex);
+        this->formatted.push_back(event->getId().getSequenceNumber());
+        this->changed.notify_all();
+        while (this->released < this->formatted.size()) {
+            this->changed.wait(lock);
+        }
+    }
+
+    /**
+     * Waits until the writer thread has started to format the @a
+     * count th event.
+     */
+    void waitForFormatted(size_t count) {
+        boost::mutex::scoped_lock lock(this->mutex);
+        while (this->formatted.size() < count) {
+            this->changed.wait(lock);
+        }
+    }
+
+    /**
+     * Lets the writer thread finish the first @a count events.
+     */
+    void release(size_t count) {
+        boost::mutex::scoped_lock lock(this->mutex);
+        this->released = count;
+        this->changed.notify_all();
+    }
+
+    void releaseAll() {
+        boost::mutex::scoped_lock lock(this->mutex);
+        this->released = size_t(-1);
+        this->changed.notify_all();
+    }
+
+    vector<boost::uint32_t> getFormatted() {
+        boost::mutex::scoped_lock lock(this->mutex);
+        return this->formatted;
+    }
+
+private:
+
+    boost::mutex              mutex;
+    boost::condition_variable changed;
+    vector<boost::uint32_t>   formatted;
+    size_t                    released;
+
+};
+
+EventPtr createEvent(const rsc::misc::UUID &participant,
+                     const boost::uint32_t &sequenceNumber) {
+    EventPtr event(new Event);
+    event->setId(participant, sequenceNumber);
+    return event;
+}
+
+}
+
+TEST(AsyncFormattingHandlerTest, testDropsOldestWhileWriting) {
+
+    boost::shared_ptr<BlockingFormatter> formatter(new BlockingFormatter);
+    ostringstream stream;
+    AsyncFormattingHandler handler(formatter, stream, 8,
+                                   AsyncFormattingHandler::DROP_OLDEST);
+
+    rsc::misc::UUID participant;
+    handler.handle(createEvent(participant, 0));
+    formatter->waitForFormatted(1);
+    for (boost::uint32_t i = 1; i <= 8; ++i) {
+        handler.handle(createEvent(participant, i));
+    }
+    // For this capacity the writer takes one event at a time. Hence,
+    // all events except event 1 remain subject to the policy.
+    formatter->release(1);
+    formatter->waitForFormatted(2);
+    for (boost::uint32_t i = 9; i <= 20; ++i) {
+        handler.handle(createEvent(participant, i));
+    }
+    formatter->releaseAll();
+    handler.stop();
+
+    vector<boost::uint32_t> expected;
+    expected.push_back(0);
+    expected.push_back(1);
+    for (boost::uint32_t i = 13; i <= 20; ++i) {
+        expected.push_back(i);
+    }
+    EXPECT_EQ(expected, formatter->getFormatted());
+    EXPECT_EQ(boost::uint64_t(11), handler.getDroppedOldest());
+    EXPECT_EQ(boost::uint64_t(0), handler.getDroppedNewest());
+
+}
@@ -0,0 +1,107 @@
+/* ============================================================
+ *
+ * This file is part of the RSB project
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "rsb/tools/logger/ListenScopes.h"
+
+using namespace std;
+using namespace testing;
+using namespace rsb;
+using namespace rsb::tools::logger;
+
+namespace {
+
+vector<ListenScope> plan(const string &first, const string &second = "",
+                         const string &third = "", const string &fourth = "") {
+    vector<string> scopes;
+    const string *all[] = { &first, &second, &third, &fourth };
+    for (size_t i = 0; i < 4; ++i) {
+        if (!all[i]->empty()) {
+            scopes.push_back(*all[i]);
+        }
+    }
+    return planListenScopes(scopes);
+}
+
+}
+
+TEST(ListenScopesTest, testCoveredLiteralScopes) {
+
+    vector<ListenScope> scopes = plan("/a/b", "/a", "/c", "/a/b/c");
+    ASSERT_EQ(size_t(2), scopes.size());
+    EXPECT_EQ(Scope("/a"), scopes[0].scope);
+    EXPECT_EQ(Scope("/c"), scopes[1].scope);
+    for (size_t i = 0; i < scopes.size(); ++i) {
+        EXPECT_TRUE(scopes[i].patterns.empty());
+        EXPECT_TRUE(scopes[i].excluded.empty());
+    }
+
+}
+
+TEST(ListenScopesTest, testCoveredPatterns) {
+
+    // a literal scope on or above the prefix of a pattern receives
+    // all its events anyway
+    vector<ListenScope> scopes = plan("/robot", "/robot/*/camera", "/robot/**");
+    ASSERT_EQ(size_t(1), scopes.size());
+    EXPECT_EQ(Scope("/robot"), scopes[0].scope);
+    EXPECT_TRUE(scopes[0].patterns.empty());
+
+}
+
+TEST(ListenScopesTest, testMergedPatterns) {
+
+    vector<ListenScope> scopes = plan("/robot/*/camera", "/robot/arm/*/joint",
+                                      "/robot/*/laser");
+    ASSERT_EQ(size_t(1), scopes.size());
+    EXPECT_EQ(Scope("/robot"), scopes[0].scope);
+    EXPECT_EQ(size_t(3), scopes[0].patterns.size());
+    EXPECT_TRUE(scopes[0].excluded.empty());
+
+}
+
+TEST(ListenScopesTest, testExcludesLiteralScopesBelowPatterns) {
+
+    vector<ListenScope> scopes = plan("/robot/*/camera/**", "/robot/left/camera",
+                                      "/other");
+    ASSERT_EQ(size_t(3), scopes.size());
+    EXPECT_EQ(Scope("/other"), scopes[0].scope);
+    EXPECT_EQ(Scope("/robot/left/camera"), scopes[1].scope);
+    EXPECT_TRUE(scopes[1].patterns.empty());
+
+    const ListenScope &filtered = scopes[2];
+    EXPECT_EQ(Scope("/robot"), filtered.scope);
+    ASSERT_EQ(size_t(1), filtered.patterns.size());
+    EXPECT_EQ("/robot/*/camera/**", filtered.patterns[0].toString());
+    ASSERT_EQ(size_t(1), filtered.excluded.size());
+    EXPECT_EQ(Scope("/robot/left/camera"), filtered.excluded[0]);
+
+}
+
+TEST(ListenScopesTest, testInvalidScopes) {
+
+    EXPECT_THROW(plan("robot/*"), invalid_argument);
+
+}
@@ -0,0 +1,255 @@
+/* ============================================================
+ *
+ * This file is part of the RSB project
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <rsc/runtime/TypeStringTools.h>
+
+#include <rsb/MetaData.h>
+
+#include <rsb/tools/simplebuffer/BinaryEncoding.h>
+#include <rsb/tools/simplebuffer/SerializedPayload.h>
+
+#include "rsb/tools/logger/RecordEventFormatter.h"
+#include "rsb/tools/replay/RecordFile.h"
+
+using namespace std;
+using namespace testing;
+using namespace rsb;
+using namespace rsb::tools::logger;
+using namespace rsb::tools::replay;
+using namespace rsb::tools::simplebuffer;
+
+namespace {
+
+string recordPath() {
+    return TempDir() + "logger-record";
+}
+
+string truncatedPath() {
+    return TempDir() + "logger-record-truncated";
+}
+
+/**
+ * Records one event per receive time and closes the container.
+ */
+void writeRecord(const string &path, const vector<boost::uint64_t> &receiveTimes) {
+    ofstream stream(path.c_str(), ios::binary);
+    RecordEventFormatter formatter(stream);
+    rsc::misc::UUID participant;
+    for (size_t i = 0; i < receiveTimes.size(); ++i) {
+        EventPtr event(new Event(Scope("/a"),
+                                 SerializedPayloadPtr(new SerializedPayload("utf-8-string",
+                                                                            "payload")),
+                                 rsc::runtime::typeName<SerializedPayload>()));
+        event->setId(participant, i);
+        event->mutableMetaData().setReceiveTime(receiveTimes[i]);
+        formatter.format(stream, event);
+    }
+}
+
+string readFile(const string &path) {
+    ifstream stream(path.c_str(), ios::binary);
+    return string((istreambuf_iterator<char>(stream)), istreambuf_iterator<char>());
+}
+
+void writeFile(const string &path, const string &contents) {
+    ofstream stream(path.c_str(), ios::binary);
+    stream.write(contents.data(), contents.size());
+}
+
+/**
+ * Seeks by decoding all events from the start of the container.
+ */
+size_t scanTo(const RecordFile &file, boost::uint64_t receiveTime) {
+    size_t offset = file.begin();
+    while (true) {
+        size_t current = offset;
+        EventPtr event = file.next(offset);
+        if (!event || event->getMetaData().getReceiveTime() >= receiveTime) {
+            return current;
+        }
+    }
+}
+
+}
+
+TEST(RecordFileTest, testSeekInCompleteFile) {
+
+    vector<boost::uint64_t> receiveTimes;
+    for (boost::uint64_t i = 0; i < 5000; ++i) {
+        receiveTimes.push_back(1000 + 2 * i);
+    }
+    writeRecord(recordPath(), receiveTimes);
+
+    RecordFile file(recordPath());
+    EXPECT_TRUE(file.isComplete());
+    EXPECT_EQ(boost::uint64_t(1000), file.getFirstReceiveTime());
+
+    const boost::uint64_t times[] = { 0, 1000, 1001, 1128, 1129, 5000, 10998 };
+    for (size_t i = 0; i < sizeof(times) / sizeof(times[0]); ++i) {
+        size_t offset = file.seek(times[i]);
+        EventPtr event = file.next(offset);
+        ASSERT_TRUE(event);
+        boost::uint64_t expected = max(boost::uint64_t(1000), times[i] + times[i] % 2);
+        EXPECT_EQ(expected, event->getMetaData().getReceiveTime());
+    }
+    size_t offset = file.seek(10999);
+    EXPECT_FALSE(file.next(offset));
+
+    remove(recordPath().c_str());
+
+}
+
+TEST(RecordFileTest, testSeekInUnclosedFile) {
+
+    vector<boost::uint64_t> receiveTimes;
+    for (boost::uint64_t i = 0; i < 10000; ++i) {
+        receiveTimes.push_back(1000 + i);
+    }
+    writeRecord(recordPath(), receiveTimes);
+    // cut off in the middle of a chunk after the first index chunk as if
+    // the logger had been killed
+    string contents = readFile(recordPath());
+    writeFile(truncatedPath(), contents.substr(0, contents.size() / 2 + 3));
+
+    RecordFile file(truncatedPath());
+    EXPECT_FALSE(file.isComplete());
+
+    size_t offset = file.begin();
+    boost::uint64_t events = 0;
+    while (file.next(offset)) {
+        ++events;
+    }
+    ASSERT_GT(events, boost::uint64_t(INDEX_STRIDE * INDEX_CHUNK_ENTRIES));
+    ASSERT_LT(events, boost::uint64_t(10000));
+
+    const boost::uint64_t times[] = { 1000, 1063, 1064, 1065, 1000 + events - 1 };
+    for (size_t i = 0; i < sizeof(times) / sizeof(times[0]); ++i) {
+        offset = file.seek(times[i]);
+        EventPtr event = file.next(offset);
+        ASSERT_TRUE(event);
+        EXPECT_EQ(times[i], event->getMetaData().getReceiveTime());
+    }
+    offset = file.seek(1000 + events);
+    EXPECT_FALSE(file.next(offset));
+
+    remove(recordPath().c_str());
+    remove(truncatedPath().c_str());
+
+}
+
+TEST(RecordFileTest, testSeekWithOutOfOrderReceiveTimes) {
+
+    // events of several listeners are not recorded in the order of
+    // their receive times, here each indexed event has been received
+    // before many of the events recorded ahead of it
+    vector<boost::uint64_t> receiveTimes;
+    for (boost::uint64_t i = 0; i < 5000; ++i) {
+        receiveTimes.push_back(i % INDEX_STRIDE == 0 ? 1500 + i : 2000 + i);
+    }
+    writeRecord(recordPath(), receiveTimes);
+
+    RecordFile file(recordPath());
+    for (boost::uint64_t time = 1400; time < 7100; time += 7) {
+        EXPECT_EQ(scanTo(file, time), file.seek(time)) << "seeking " << time;
+    }
+
+    remove(recordPath().c_str());
+
+}
+
+TEST(RecordFileTest, testReportsCorruptEvents) {
+
+    vector<boost::uint64_t> receiveTimes(3, 1000);
+    writeRecord(recordPath(), receiveTimes);
+
+    // let the length of the scope of the first event exceed its chunk
+    string contents = readFile(recordPath());
+    size_t scopeLength = RECORD_MAGIC.size() + CHUNK_HEADER_SIZE + 20;
+    contents.replace(scopeLength, 4, 4, char(0xff));
+    writeFile(recordPath(), contents);
+
+    RecordFile file(recordPath());
+    size_t offset = file.begin();
+    EXPECT_THROW(file.next(offset), runtime_error);
+
+    remove(recordPath().c_str());
+
+}
+
+TEST(RecordFileTest, testFallsBackOnDamagedIndex) {
+
+    vector<boost::uint64_t> receiveTimes;
+    for (boost::uint64_t i = 0; i < 10000; ++i) {
+        receiveTimes.push_back(1000 + i);
+    }
+    writeRecord(recordPath(), receiveTimes);
+    const string contents = readFile(recordPath());
+    size_t offset = 0;
+    const size_t lastIndex = decodeTrailer(contents.data() + contents.size() - 8, 8);
+
+    // the last index chunk refers to itself
+    string damaged = contents;
+    string self;
+    writeUint64(self, lastIndex);
+    damaged.replace(lastIndex + CHUNK_HEADER_SIZE, 8, self);
+    writeFile(recordPath(), damaged);
+    {
+        RecordFile file(recordPath());
+        EXPECT_FALSE(file.isComplete());
+        offset = file.seek(5000);
+        EventPtr event = file.next(offset);
+        ASSERT_TRUE(event);
+        EXPECT_EQ(boost::uint64_t(5000), event->getMetaData().getReceiveTime());
+    }
+
+    // the last index chunk claims more entries than it contains
+    damaged = contents;
+    damaged.replace(lastIndex + CHUNK_HEADER_SIZE + 8, 4, 4, char(0xff));
+    writeFile(recordPath(), damaged);
+    {
+        RecordFile file(recordPath());
+        EXPECT_FALSE(file.isComplete());
+        offset = file.seek(10999);
+        EventPtr event = file.next(offset);
+        ASSERT_TRUE(event);
+        EXPECT_EQ(boost::uint64_t(10999), event->getMetaData().getReceiveTime());
+    }
+
+    remove(recordPath().c_str());
+
+}
+
+TEST(RecordFileTest, testRejectsOtherFiles) {
+
+    writeFile(recordPath(), "RSBSNP01 is not a record");
+    EXPECT_THROW(RecordFile file(recordPath()), runtime_error);
+
+    remove(recordPath().c_str());
+
+}
@@ -0,0 +1,204 @@
+/* ============================================================
+ *
+ * This file is part of the RSB project
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <rsc/runtime/TypeStringTools.h>
+
+#include <rsb/MetaData.h>
+
+#include <rsb/tools/simplebuffer/EventRecord.h>
+#include <rsb/tools/simplebuffer/SerializedPayload.h>
+
+#include "rsb/tools/logger/RecordEventFormatter.h"
+#include "rsb/tools/logger/RecordFormat.h"
+
+using namespace std;
+using namespace testing;
+using namespace rsb;
+using namespace rsb::tools::logger;
+using namespace rsb::tools::simplebuffer;
+
+namespace {
+
+EventPtr createRecordedEvent(const rsc::misc::UUID &participant,
+                             const boost::uint32_t &sequenceNumber,
+                             const boost::uint64_t &receiveTime) {
+    EventPtr event(new Event(Scope("/robot/camera"),
+                             SerializedPayloadPtr(new SerializedPayload("utf-8-string", "payload")),
+                             rsc::runtime::typeName<SerializedPayload>()));
+    event->setId(participant, sequenceNumber);
+    event->mutableMetaData().setReceiveTime(receiveTime);
+    return event;
+}
+
+}
+
+TEST(RecordFormatTest, testEventRoundTrip) {
+
+    rsc::misc::UUID participant;
+    EventPtr event = createRecordedEvent(participant, 42, 3000);
+    event->setMethod("REQUEST");
+    event->mutableMetaData().setCreateTime(1000);
+    event->mutableMetaData().setSendTime(2000);
+    event->mutableMetaData().setDeliverTime(4000);
+    event->mutableMetaData().setUserTime("grabbed", 500);
+    event->mutableMetaData().setUserInfo("frame", "base");
+    event->addCause(EventId(rsc::misc::UUID(), 7));
+
+    string body;
+    encodeEventRecord(event, body);
+    EventPtr decoded = decodeEventRecord(body.data(), body.size());
+
+    EXPECT_EQ(event->getId(), decoded->getId());
+    EXPECT_EQ(*event->getScopePtr(), *decoded->getScopePtr());
+    EXPECT_EQ("REQUEST", decoded->getMethod());
+    EXPECT_EQ(rsc::runtime::typeName<SerializedPayload>(), decoded->getType());
+    SerializedPayloadPtr payload = getSerializedPayload(decoded);
+    EXPECT_EQ("utf-8-string", payload->first);
+    EXPECT_EQ("payload", payload->second);
+
+    const MetaData &metaData = decoded->getMetaData();
+    EXPECT_EQ(boost::uint64_t(1000), metaData.getCreateTime());
+    EXPECT_EQ(boost::uint64_t(2000), metaData.getSendTime());
+    EXPECT_EQ(boost::uint64_t(3000), metaData.getReceiveTime());
+    EXPECT_EQ(boost::uint64_t(4000), metaData.getDeliverTime());
+    EXPECT_EQ(boost::uint64_t(500), metaData.getUserTime("grabbed"));
+    EXPECT_EQ("base", metaData.getUserInfo("frame"));
+    EXPECT_EQ(event->getCauses(), decoded->getCauses());
+
+}
+
+TEST(RecordFormatTest, testRejectsConvertedPayloads) {
+
+    EventPtr event(new Event(Scope("/a"), boost::shared_ptr<string>(new string("payload")),
+                             rsc::runtime::typeName<string>()));
+    string body;
+    EXPECT_THROW(encodeEventRecord(event, body), invalid_argument);
+
+}
+
+TEST(RecordFormatTest, testTruncatedBody) {
+
+    string body;
+    encodeEventRecord(createRecordedEvent(rsc::misc::UUID(), 0, 1000), body);
+    for (size_t size = 0; size < body.size(); ++size) {
+        EXPECT_THROW(decodeEventRecord(body.data(), size), out_of_range)
+            << "truncated to " << size << " bytes";
+    }
+
+}
+
+TEST(RecordFormatTest, testChunkHeader) {
+
+    string chunk = RECORD_MAGIC;
+    appendChunk(chunk, INDEX_CHUNK, string(10, 'x'));
+
+    ChunkType type;
+    size_t bodySize;
+    ASSERT_TRUE(readChunkHeader(chunk.data(), chunk.size(), RECORD_MAGIC.size(),
+                                type, bodySize));
+    EXPECT_EQ(INDEX_CHUNK, type);
+    EXPECT_EQ(size_t(10), bodySize);
+
+    // incomplete chunks are not reported
+    EXPECT_FALSE(readChunkHeader(chunk.data(), chunk.size() - 1, RECORD_MAGIC.size(),
+                                 type, bodySize));
+    EXPECT_FALSE(readChunkHeader(chunk.data(), RECORD_MAGIC.size() + 3,
+                                 RECORD_MAGIC.size(), type, bodySize));
+
+}
+
+TEST(RecordFormatTest, testIndexAndTrailerChain) {
+
+    const boost::uint32_t numEvents = 5000;
+    ostringstream stream;
+    {
+        RecordEventFormatter formatter(stream);
+        rsc::misc::UUID participant;
+        for (boost::uint32_t i = 0; i < numEvents; ++i) {
+            formatter.format(stream, createRecordedEvent(participant, i, 1000 + i));
+        }
+    }
+    const string container = stream.str();
+    const char *data = container.data();
+    const size_t size = container.size();
+    ASSERT_EQ(0, container.compare(0, RECORD_MAGIC.size(), RECORD_MAGIC));
+
+    ChunkType type;
+    size_t bodySize;
+    ASSERT_TRUE(readChunkHeader(data, size, size - TRAILER_SIZE, type, bodySize));
+    ASSERT_EQ(TRAILER_CHUNK, type);
+    boost::uint64_t index = decodeTrailer(data + size - TRAILER_SIZE + CHUNK_HEADER_SIZE,
+                                          bodySize);
+
+    // index chunks are chained from the last to the first one
+    vector<IndexEntry> entries;
+    unsigned int chunks = 0;
+    while (index != 0) {
+        ASSERT_TRUE(readChunkHeader(data, size, index, type, bodySize));
+        ASSERT_EQ(INDEX_CHUNK, type);
+        vector<IndexEntry> chunkEntries;
+        index = decodeIndex(data + index + CHUNK_HEADER_SIZE, bodySize, chunkEntries);
+        entries.insert(entries.begin(), chunkEntries.begin(), chunkEntries.end());
+        ++chunks;
+    }
+
+    const size_t expectedEntries = (numEvents + INDEX_STRIDE - 1) / INDEX_STRIDE;
+    EXPECT_EQ(expectedEntries, entries.size());
+    EXPECT_EQ((expectedEntries + INDEX_CHUNK_ENTRIES - 1) / INDEX_CHUNK_ENTRIES, chunks);
+    for (size_t i = 0; i < entries.size(); ++i) {
+        ASSERT_TRUE(readChunkHeader(data, size, entries[i].offset, type, bodySize));
+        ASSERT_EQ(EVENT_CHUNK, type);
+        EventPtr event = decodeEventRecord(data + entries[i].offset + CHUNK_HEADER_SIZE,
+                                             bodySize);
+        EXPECT_EQ(boost::uint32_t(i * INDEX_STRIDE), event->getId().getSequenceNumber());
+        EXPECT_EQ(event->getMetaData().getReceiveTime(), entries[i].receiveTime);
+    }
+
+}
+
+TEST(RecordFormatTest, testIndexRoundTrip) {
+
+    vector<IndexEntry> entries;
+    for (boost::uint64_t i = 0; i < 3; ++i) {
+        IndexEntry entry;
+        entry.receiveTime = 1000 * i;
+        entry.offset = 8 + 100 * i;
+        entries.push_back(entry);
+    }
+    string body;
+    encodeIndex(12345, entries, body);
+
+    vector<IndexEntry> decoded;
+    EXPECT_EQ(boost::uint64_t(12345), decodeIndex(body.data(), body.size(), decoded));
+    ASSERT_EQ(entries.size(), decoded.size());
+    for (size_t i = 0; i < entries.size(); ++i) {
+        EXPECT_EQ(entries[i].receiveTime, decoded[i].receiveTime);
+        EXPECT_EQ(entries[i].offset, decoded[i].offset);
+    }
+    EXPECT_THROW(decodeIndex(body.data(), body.size() - 1, decoded), out_of_range);
+
+}
@@ -0,0 +1,111 @@
+/* ============================================================
+ *
+ * This file is part of the RSB project
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "rsb/tools/logger/ScopePatternFilter.h"
+
+using namespace std;
+using namespace testing;
+using namespace rsb;
+using namespace rsb::tools::logger;
+
+namespace {
+
+EventPtr createEvent(const Scope &scope) {
+    EventPtr event(new Event);
+    event->setScope(scope);
+    return event;
+}
+
+}
+
+TEST(ScopePatternTest, testComponentWildcards) {
+
+    ScopePattern pattern("/robot/*/camera/**");
+    EXPECT_TRUE(pattern.hasWildcards());
+    EXPECT_EQ(Scope("/robot"), pattern.getPrefix());
+
+    EXPECT_TRUE(pattern.matches(Scope("/robot/left/camera")));
+    EXPECT_TRUE(pattern.matches(Scope("/robot/left/camera/raw/depth")));
+    EXPECT_FALSE(pattern.matches(Scope("/robot/camera")));
+    EXPECT_FALSE(pattern.matches(Scope("/robot/left/right/camera")));
+    EXPECT_FALSE(pattern.matches(Scope("/robot/left/laser")));
+    EXPECT_FALSE(pattern.matches(Scope("/other/left/camera")));
+
+}
+
+TEST(ScopePatternTest, testLeadingDoubleWildcard) {
+
+    ScopePattern pattern("/**/x");
+    EXPECT_EQ(Scope("/"), pattern.getPrefix());
+
+    EXPECT_TRUE(pattern.matches(Scope("/x")));
+    EXPECT_TRUE(pattern.matches(Scope("/a/x")));
+    EXPECT_TRUE(pattern.matches(Scope("/a/b/c/x")));
+    EXPECT_FALSE(pattern.matches(Scope("/a/x/b")));
+    EXPECT_FALSE(pattern.matches(Scope("/a/xy")));
+
+}
+
+TEST(ScopePatternTest, testWildcardWithinComponent) {
+
+    ScopePattern pattern("/cam*era/x");
+    EXPECT_EQ(Scope("/"), pattern.getPrefix());
+    EXPECT_TRUE(pattern.matches(Scope("/camera/x")));
+    EXPECT_TRUE(pattern.matches(Scope("/cam_left_era/x")));
+    EXPECT_FALSE(pattern.matches(Scope("/camer/x")));
+
+}
+
+TEST(ScopePatternTest, testLiteralScopes) {
+
+    ScopePattern pattern("/a/b/");
+    EXPECT_FALSE(pattern.hasWildcards());
+    EXPECT_EQ(Scope("/a/b"), pattern.getPrefix());
+    EXPECT_TRUE(pattern.matches(Scope("/a/b")));
+    EXPECT_FALSE(pattern.matches(Scope("/a/b/c")));
+
+    EXPECT_TRUE(ScopePattern::isPattern("/a/*"));
+    EXPECT_FALSE(ScopePattern::isPattern("/a/b"));
+    EXPECT_THROW(ScopePattern("a/*"), invalid_argument);
+
+}
+
+TEST(ScopePatternFilterTest, testExcludedScopes) {
+
+    vector<ScopePattern> patterns;
+    patterns.push_back(ScopePattern("/robot/*/camera/**"));
+    patterns.push_back(ScopePattern("/robot/**/laser"));
+    vector<Scope> excluded;
+    excluded.push_back(Scope("/robot/left/camera/raw"));
+    ScopePatternFilter filter(patterns, excluded);
+
+    EXPECT_TRUE(filter.match(createEvent(Scope("/robot/left/camera"))));
+    EXPECT_TRUE(filter.match(createEvent(Scope("/robot/left/camera/depth"))));
+    EXPECT_TRUE(filter.match(createEvent(Scope("/robot/base/front/laser"))));
+    EXPECT_FALSE(filter.match(createEvent(Scope("/robot/left/camera/raw"))));
+    EXPECT_FALSE(filter.match(createEvent(Scope("/robot/left/camera/raw/x"))));
+    EXPECT_FALSE(filter.match(createEvent(Scope("/robot/left/microphone"))));
+
+}
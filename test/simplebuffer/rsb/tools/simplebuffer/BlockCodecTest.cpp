@@ -0,0 +1,109 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include <stdexcept>
+#include <string>
+
+#include <boost/cstdint.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "rsb/tools/simplebuffer/BlockCodec.h"
+
+using namespace std;
+using namespace testing;
+using namespace rsb::tools::simplebuffer;
+
+namespace {
+
+void expectRoundtrip(const string &input) {
+    string compressed;
+    compressBlock(input, compressed);
+    string output;
+    decompressBlock(compressed.data(), compressed.size(), input.size(),
+            output);
+    EXPECT_EQ(input, output);
+}
+
+}
+
+TEST(BlockCodecTest, testRoundtrip) {
+
+    expectRoundtrip("");
+    expectRoundtrip("a");
+    expectRoundtrip("short literal");
+    expectRoundtrip(string(100000, 'x'));
+
+    string text;
+    for (unsigned int i = 0; i < 5000; ++i) {
+        text += "timestamp=" + string(1, char('0' + i % 10)) + " level=INFO ";
+    }
+    expectRoundtrip(text);
+
+    // incompressible bytes with long literal runs
+    string noise;
+    boost::uint32_t state = 1;
+    for (unsigned int i = 0; i < 70000; ++i) {
+        state = state * 1103515245 + 12345;
+        noise.push_back(char(state >> 16));
+    }
+    expectRoundtrip(noise);
+    expectRoundtrip(noise + noise.substr(0, 1000) + text);
+
+}
+
+TEST(BlockCodecTest, testCompressesRepetitions) {
+    string input(10000, 'a');
+    string compressed;
+    compressBlock(input, compressed);
+    EXPECT_LT(compressed.size(), size_t(100));
+}
+
+TEST(BlockCodecTest, testRejectsCorruptBlocks) {
+
+    string input;
+    for (unsigned int i = 0; i < 100; ++i) {
+        input += "abcdefgh";
+    }
+    string compressed;
+    compressBlock(input, compressed);
+
+    string output;
+    EXPECT_THROW(
+            decompressBlock(compressed.data(), compressed.size(),
+                    input.size() - 1, output), invalid_argument);
+    EXPECT_THROW(
+            decompressBlock(compressed.data(), compressed.size() - 3,
+                    input.size(), output), invalid_argument);
+    string badOffset = compressed;
+    badOffset[1 + 8] = char(0xff);
+    badOffset[1 + 9] = char(0xff);
+    EXPECT_THROW(
+            decompressBlock(badOffset.data(), badOffset.size(), input.size(),
+                    output), invalid_argument);
+
+}
@@ -0,0 +1,123 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <rsb/MetaData.h>
+
+#include "rsb/tools/simplebuffer/BloomFilteredBuffer.h"
+#include "rsb/tools/simplebuffer/RotatingBloomFilter.h"
+#include "rsb/tools/simplebuffer/TimeBoundedBuffer.h"
+
+#include "testhelpers.h"
+
+using namespace std;
+using namespace testing;
+using namespace rsb;
+using namespace rsb::tools::simplebuffer;
+
+TEST(BloomFilteredBufferTest, testFilterHasNoFalseNegatives) {
+
+    RotatingBloomFilter filter(1000, 1000);
+    filter.advance(10000);
+
+    rsc::misc::UUID participant;
+    for (boost::uint32_t i = 0; i < 1000; ++i) {
+        filter.add(EventId(participant, i));
+    }
+    for (boost::uint32_t i = 0; i < 1000; ++i) {
+        EXPECT_TRUE(filter.mightContain(EventId(participant, i)));
+    }
+
+    size_t falsePositives = 0;
+    for (boost::uint32_t i = 1000; i < 11000; ++i) {
+        if (filter.mightContain(EventId(participant, i))) {
+            ++falsePositives;
+        }
+    }
+    EXPECT_LT(falsePositives, size_t(300));
+
+}
+
+TEST(BloomFilteredBufferTest, testFilterForgetsAfterRetention) {
+
+    RotatingBloomFilter filter(1000, 100);
+    filter.advance(10000);
+
+    rsc::misc::UUID participant;
+    EventId id(participant, 42);
+    filter.add(id);
+
+    // kept for at least the retention time
+    filter.advance(11499);
+    EXPECT_TRUE(filter.mightContain(id));
+    // old times must not rotate
+    filter.advance(5000);
+    EXPECT_TRUE(filter.mightContain(id));
+
+    filter.advance(12000);
+    EXPECT_FALSE(filter.mightContain(id));
+
+    // large jumps clear everything at once
+    filter.add(id);
+    filter.advance(1000000);
+    EXPECT_FALSE(filter.mightContain(id));
+
+}
+
+TEST(BloomFilteredBufferTest, testAnswersMissesFromFilter) {
+
+    BloomFilteredBuffer buffer(BufferPtr(new TimeBoundedBuffer(1000, false)),
+            1000, 100);
+
+    rsc::misc::UUID participant;
+    for (boost::uint32_t i = 0; i < 10; ++i) {
+        buffer.insert(createEvent(participant, i, 10000 + i));
+    }
+    EXPECT_EQ(size_t(10), buffer.size());
+
+    for (boost::uint32_t i = 0; i < 10; ++i) {
+        EXPECT_TRUE(buffer.get(EventId(participant, i)));
+    }
+    EXPECT_EQ(boost::uint64_t(0), buffer.getFilteredMisses());
+
+    rsc::misc::UUID unknown;
+    for (boost::uint32_t i = 0; i < 100; ++i) {
+        EXPECT_FALSE(buffer.get(EventId(unknown, i)));
+    }
+    EXPECT_EQ(boost::uint64_t(100),
+            buffer.getFilteredMisses() + buffer.getUnfilteredMisses());
+    EXPECT_GT(buffer.getFilteredMisses(), boost::uint64_t(90));
+
+    // expired events are found neither in the buffer nor in the filter
+    buffer.removeOld(20000);
+    EXPECT_EQ(size_t(0), buffer.size());
+    boost::uint64_t filtered = buffer.getFilteredMisses();
+    EXPECT_FALSE(buffer.get(EventId(participant, 0)));
+    EXPECT_EQ(filtered + 1, buffer.getFilteredMisses());
+
+}
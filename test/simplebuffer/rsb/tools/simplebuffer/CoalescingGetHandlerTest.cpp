@@ -0,0 +1,243 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include <vector>
+
+#include <boost/thread.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <rsb/MetaData.h>
+
+#include "rsb/tools/simplebuffer/CoalescingGetHandler.h"
+#include "rsb/tools/simplebuffer/RingBuffer.h"
+
+using namespace std;
+using namespace testing;
+using namespace rsb;
+using namespace rsb::tools::simplebuffer;
+
+namespace {
+
+/**
+ * Collects replies instead of publishing them.
+ */
+class RecordingGetHandler: public CoalescingGetHandler {
+public:
+
+    RecordingGetHandler(BufferPtr buffer, const unsigned int &numWorkers) :
+            CoalescingGetHandler(buffer, InformerBasePtr(), numWorkers) {
+    }
+
+    vector<EventPtr> waitForReplies(const size_t &count) {
+        boost::mutex::scoped_lock lock(mutex);
+        while (replies.size() < count) {
+            replied.wait(lock);
+        }
+        return replies;
+    }
+
+protected:
+
+    void publishReply(EventPtr reply) {
+        boost::mutex::scoped_lock lock(mutex);
+        replies.push_back(reply);
+        replied.notify_all();
+    }
+
+private:
+
+    boost::mutex mutex;
+    boost::condition_variable replied;
+    vector<EventPtr> replies;
+
+};
+
+/**
+ * Looks up events immediately but blocks returning them until released.
+ */
+class BlockingBuffer: public RingBuffer {
+public:
+
+    BlockingBuffer() :
+            RingBuffer(1000), lookups(0), released(false) {
+    }
+
+    EventPtr get(const EventId &id) {
+        EventPtr event = RingBuffer::get(id);
+        boost::mutex::scoped_lock lock(mutex);
+        ++lookups;
+        lookedUp.notify_all();
+        while (!released) {
+            release.wait(lock);
+        }
+        return event;
+    }
+
+    void waitForLookups(const size_t &count) {
+        boost::mutex::scoped_lock lock(mutex);
+        while (lookups < count) {
+            lookedUp.wait(lock);
+        }
+    }
+
+    void unblock() {
+        boost::mutex::scoped_lock lock(mutex);
+        released = true;
+        release.notify_all();
+    }
+
+private:
+
+    boost::mutex mutex;
+    boost::condition_variable lookedUp;
+    boost::condition_variable release;
+    size_t lookups;
+    bool released;
+
+};
+
+EventPtr createRequest(const rsc::misc::UUID &client,
+        const boost::uint32_t &sequenceNumber, const EventId &requested) {
+    EventPtr request(new Event);
+    request->setId(client, sequenceNumber);
+    request->setScope(Scope("/buffer/get"));
+    request->setMethod("REQUEST");
+    request->setType(rsc::runtime::typeName<EventId>());
+    request->setData(boost::shared_ptr<EventId>(new EventId(requested)));
+    return request;
+}
+
+}
+
+TEST(CoalescingGetHandlerTest, testReplies) {
+
+    BufferPtr buffer(new RingBuffer(1000));
+    rsc::misc::UUID participant;
+    EventPtr event(new Event);
+    event->setId(participant, 0);
+    event->setScope(Scope("/data"));
+    event->setType("string");
+    event->setData(boost::shared_ptr<string>(new string("payload")));
+    event->mutableMetaData().setDeliverTime(10);
+    buffer->insert(event);
+
+    RecordingGetHandler handler(buffer, 4);
+    rsc::misc::UUID client;
+    handler.handle(createRequest(client, 0, EventId(participant, 0)));
+    handler.handle(createRequest(client, 1, EventId(participant, 1)));
+
+    vector<EventPtr> replies = handler.waitForReplies(2);
+    for (vector<EventPtr>::const_iterator it = replies.begin();
+            it != replies.end(); ++it) {
+        EXPECT_EQ("REPLY", (*it)->getMethod());
+        EXPECT_EQ(Scope("/buffer/get"), *(*it)->getScopePtr());
+        if ((*it)->isCause(EventId(client, 0))) {
+            EXPECT_EQ("string", (*it)->getType());
+            EXPECT_EQ(event->getData(), (*it)->getData());
+        } else {
+            EXPECT_TRUE((*it)->isCause(EventId(client, 1)));
+            EXPECT_FALSE((*it)->getData());
+        }
+    }
+    EXPECT_EQ(boost::uint64_t(0), handler.getCoalescedRequests());
+
+}
+
+TEST(CoalescingGetHandlerTest, testCoalescesConcurrentRequests) {
+
+    boost::shared_ptr<BlockingBuffer> buffer(new BlockingBuffer);
+    rsc::misc::UUID participant;
+    EventPtr event(new Event);
+    event->setId(participant, 0);
+    event->setScope(Scope("/data"));
+    event->mutableMetaData().setDeliverTime(10);
+    buffer->insert(event);
+
+    RecordingGetHandler handler(buffer, 1);
+    rsc::misc::UUID client;
+    // the only worker is busy with the first request, all further ones wait
+    // for the second lookup
+    handler.handle(createRequest(client, 0, EventId(participant, 0)));
+    buffer->waitForLookups(1);
+    for (boost::uint32_t i = 1; i < 5; ++i) {
+        handler.handle(createRequest(client, i, EventId(participant, 0)));
+    }
+    buffer->unblock();
+
+    vector<EventPtr> replies = handler.waitForReplies(5);
+    EXPECT_EQ(size_t(5), replies.size());
+    for (boost::uint32_t i = 0; i < 5; ++i) {
+        bool answered = false;
+        for (vector<EventPtr>::const_iterator it = replies.begin();
+                it != replies.end(); ++it) {
+            answered = answered || (*it)->isCause(EventId(client, i));
+        }
+        EXPECT_TRUE(answered);
+    }
+    EXPECT_EQ(boost::uint64_t(3), handler.getCoalescedRequests());
+
+}
+
+TEST(CoalescingGetHandlerTest, testDoesNotCoalesceOntoRunningLookups) {
+
+    boost::shared_ptr<BlockingBuffer> buffer(new BlockingBuffer);
+    rsc::misc::UUID participant;
+    EventPtr event(new Event);
+    event->setId(participant, 0);
+    event->setScope(Scope("/data"));
+    event->setType("string");
+    event->setData(boost::shared_ptr<string>(new string("payload")));
+    event->mutableMetaData().setDeliverTime(10);
+
+    RecordingGetHandler handler(buffer, 2);
+    rsc::misc::UUID client;
+    handler.handle(createRequest(client, 0, EventId(participant, 0)));
+    buffer->waitForLookups(1);
+
+    // inserted after the first lookup missed the event, hence the second
+    // request needs a lookup of its own
+    buffer->insert(event);
+    handler.handle(createRequest(client, 1, EventId(participant, 0)));
+    buffer->waitForLookups(2);
+    buffer->unblock();
+
+    vector<EventPtr> replies = handler.waitForReplies(2);
+    ASSERT_EQ(size_t(2), replies.size());
+    for (vector<EventPtr>::const_iterator it = replies.begin();
+            it != replies.end(); ++it) {
+        if ((*it)->isCause(EventId(client, 0))) {
+            EXPECT_FALSE((*it)->getData());
+        } else {
+            EXPECT_TRUE((*it)->isCause(EventId(client, 1)));
+            EXPECT_EQ("string", (*it)->getType());
+            EXPECT_EQ(event->getData(), (*it)->getData());
+        }
+    }
+    EXPECT_EQ(boost::uint64_t(0), handler.getCoalescedRequests());
+
+}
@@ -0,0 +1,214 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include <boost/thread.hpp>
+#include <boost/type_traits/aligned_storage.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <rsb/MetaData.h>
+
+#include "rsb/tools/simplebuffer/ConcurrentReadBuffer.h"
+
+#include "testhelpers.h"
+
+using namespace std;
+using namespace testing;
+using namespace rsb;
+using namespace rsb::tools::simplebuffer;
+
+namespace {
+
+class Reader {
+public:
+
+    Reader(ConcurrentReadBuffer &buffer, const rsc::misc::UUID &participant,
+            volatile bool &stop) :
+            buffer(buffer), participant(participant), stop(stop), mismatches(
+                    0) {
+    }
+
+    void operator()() {
+        boost::uint32_t sequenceNumber = 0;
+        while (!stop) {
+            EventPtr event = buffer.get(EventId(participant, sequenceNumber));
+            if (event
+                    && !(event->getId() == EventId(participant, sequenceNumber))) {
+                ++mismatches;
+            }
+            sequenceNumber = (sequenceNumber + 7) % 20000;
+        }
+    }
+
+    ConcurrentReadBuffer &buffer;
+    rsc::misc::UUID participant;
+    volatile bool &stop;
+    unsigned int mismatches;
+
+};
+
+/**
+ * Reads one event from each of several buffers which are created one after
+ * another at the same address.
+ */
+class DestroyedBufferReader {
+public:
+
+    DestroyedBufferReader(ConcurrentReadBuffer *buffer,
+            const rsc::misc::UUID &participant, const unsigned int &rounds,
+            boost::barrier &barrier) :
+            found(0), buffer(buffer), participant(participant), rounds(
+                    rounds), barrier(barrier) {
+    }
+
+    void operator()() {
+        for (boost::uint32_t i = 0; i < rounds; ++i) {
+            barrier.wait();
+            if (buffer->get(EventId(participant, i))) {
+                ++found;
+            }
+            barrier.wait();
+        }
+    }
+
+    unsigned int found;
+
+private:
+
+    ConcurrentReadBuffer *buffer;
+    rsc::misc::UUID participant;
+    unsigned int rounds;
+    boost::barrier &barrier;
+
+};
+
+}
+
+TEST(ConcurrentReadBufferTest, testInsertGetAndExpiry) {
+
+    const boost::uint64_t delta = 100;
+    ConcurrentReadBuffer buffer(delta, 4);
+    rsc::misc::UUID participant;
+
+    for (boost::uint32_t i = 0; i < 1000; ++i) {
+        buffer.insert(createEvent(participant, i, 1 + 10 * i));
+    }
+
+    EXPECT_EQ(size_t(10), buffer.size());
+    for (boost::uint32_t i = 0; i < 1000; ++i) {
+        EXPECT_EQ(i >= 990, bool(buffer.get(EventId(participant, i))))
+            << "Event " << i;
+    }
+
+}
+
+TEST(ConcurrentReadBufferTest, testConcurrentReaders) {
+
+    ConcurrentReadBuffer buffer(500);
+    rsc::misc::UUID participant;
+    volatile bool stop = false;
+
+    vector<boost::shared_ptr<Reader> > readers;
+    boost::thread_group threads;
+    for (unsigned int i = 0; i < 4; ++i) {
+        readers.push_back(
+                boost::shared_ptr<Reader>(
+                        new Reader(buffer, participant, stop)));
+        threads.create_thread(boost::ref(*readers.back()));
+    }
+
+    for (boost::uint32_t i = 0; i < 20000; ++i) {
+        buffer.insert(createEvent(participant, i, 1 + i));
+    }
+    stop = true;
+    threads.join_all();
+
+    for (unsigned int i = 0; i < readers.size(); ++i) {
+        EXPECT_EQ(0u, readers[i]->mismatches);
+    }
+    EXPECT_EQ(size_t(500), buffer.size());
+    EXPECT_TRUE(buffer.get(EventId(participant, 19999)));
+    EXPECT_FALSE(buffer.get(EventId(participant, 19499)));
+
+}
+
+TEST(ConcurrentReadBufferTest, testReaderOfDestroyedBuffers) {
+
+    // later buffers at the same address must not hand out the reader record
+    // which a destroyed buffer registered for the reading thread
+    boost::aligned_storage<sizeof(ConcurrentReadBuffer),
+            boost::alignment_of<ConcurrentReadBuffer>::value> storage;
+    ConcurrentReadBuffer *buffer =
+            static_cast<ConcurrentReadBuffer*>(storage.address());
+    rsc::misc::UUID participant;
+    const unsigned int rounds = 3;
+    boost::barrier barrier(2);
+    DestroyedBufferReader reader(buffer, participant, rounds, barrier);
+    boost::thread thread(boost::ref(reader));
+
+    for (boost::uint32_t i = 0; i < rounds; ++i) {
+        new (buffer) ConcurrentReadBuffer(1000);
+        buffer->insert(createEvent(participant, i, 1));
+        barrier.wait();
+        barrier.wait();
+        buffer->~ConcurrentReadBuffer();
+    }
+    thread.join();
+
+    EXPECT_EQ(rounds, reader.found);
+
+}
+
+TEST(ConcurrentReadBufferTest, testGetRangeWithOutOfOrderEvents) {
+
+    ConcurrentReadBuffer buffer(1000);
+    rsc::misc::UUID participant;
+
+    // the late events 3 and 4 follow event 2 which was delivered after the
+    // end of the requested range
+    const boost::uint64_t deliverTimes[] = { 10, 20, 50, 30, 15, 60 };
+    for (boost::uint32_t i = 0; i < 6; ++i) {
+        buffer.insert(createEvent(participant, i, deliverTimes[i]));
+    }
+
+    vector<EventPtr> events;
+    buffer.getRange(Scope("/test"), 12, 40, events);
+    ASSERT_EQ(size_t(3), events.size());
+    EXPECT_EQ(EventId(participant, 4), events[0]->getId());
+    EXPECT_EQ(EventId(participant, 1), events[1]->getId());
+    EXPECT_EQ(EventId(participant, 3), events[2]->getId());
+
+    events.clear();
+    buffer.getRange(Scope("/test"), 0, 100, events);
+    ASSERT_EQ(size_t(6), events.size());
+    for (size_t i = 1; i < events.size(); ++i) {
+        EXPECT_LE(events[i - 1]->getMetaData().getDeliverTime(),
+                events[i]->getMetaData().getDeliverTime());
+    }
+
+}
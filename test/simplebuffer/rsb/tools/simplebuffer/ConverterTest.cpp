@@ -0,0 +1,132 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <rsb/converter/SerializationException.h>
+
+#include "rsb/tools/simplebuffer/EventIdListConverter.h"
+#include "rsb/tools/simplebuffer/ReplayRequest.h"
+#include "rsb/tools/simplebuffer/ReplayRequestConverter.h"
+#include "rsb/tools/simplebuffer/TimePoint.h"
+#include "rsb/tools/simplebuffer/TimePointConverter.h"
+#include "rsb/tools/simplebuffer/TimeRange.h"
+#include "rsb/tools/simplebuffer/TimeRangeConverter.h"
+
+using namespace std;
+using namespace testing;
+using namespace rsb;
+using namespace rsb::converter;
+using namespace rsb::tools::simplebuffer;
+
+TEST(ConverterTest, testTimeRangeRoundtrip) {
+
+    TimeRangeConverter converter;
+    TimeRangePtr range(new TimeRange(Scope("/a/b"), 42, 0xffffffffffull));
+
+    string wire;
+    string wireSchema = converter.serialize(
+            make_pair(converter.getDataType(), range), wire);
+    EXPECT_EQ(TimeRangeConverter::WIRE_SCHEMA, wireSchema);
+
+    AnnotatedData data = converter.deserialize(wireSchema, wire);
+    EXPECT_EQ(converter.getDataType(), data.first);
+    TimeRangePtr result = boost::static_pointer_cast<TimeRange>(data.second);
+    EXPECT_EQ(range->getScope(), result->getScope());
+    EXPECT_EQ(range->getStart(), result->getStart());
+    EXPECT_EQ(range->getEnd(), result->getEnd());
+
+    EXPECT_THROW(converter.deserialize(wireSchema, "short"),
+            SerializationException);
+
+}
+
+TEST(ConverterTest, testTimePointRoundtrip) {
+
+    TimePointConverter converter;
+    TimePointPtr point(new TimePoint(Scope("/a/b"), 0xffffffffffull));
+
+    string wire;
+    string wireSchema = converter.serialize(
+            make_pair(converter.getDataType(), point), wire);
+    EXPECT_EQ(TimePointConverter::WIRE_SCHEMA, wireSchema);
+
+    AnnotatedData data = converter.deserialize(wireSchema, wire);
+    EXPECT_EQ(converter.getDataType(), data.first);
+    TimePointPtr result = boost::static_pointer_cast<TimePoint>(data.second);
+    EXPECT_EQ(point->getScope(), result->getScope());
+    EXPECT_EQ(point->getTime(), result->getTime());
+
+    EXPECT_THROW(converter.deserialize(wireSchema, "short"),
+            SerializationException);
+
+}
+
+TEST(ConverterTest, testReplayRequestRoundtrip) {
+
+    ReplayRequestConverter converter;
+    ReplayRequestPtr request(
+            new ReplayRequest(Scope("/a/b"), 0xffffffffffull, Scope("/c")));
+
+    string wire;
+    string wireSchema = converter.serialize(
+            make_pair(converter.getDataType(), request), wire);
+    EXPECT_EQ(ReplayRequestConverter::WIRE_SCHEMA, wireSchema);
+
+    AnnotatedData data = converter.deserialize(wireSchema, wire);
+    EXPECT_EQ(converter.getDataType(), data.first);
+    ReplayRequestPtr result = boost::static_pointer_cast<ReplayRequest>(
+            data.second);
+    EXPECT_EQ(request->getScope(), result->getScope());
+    EXPECT_EQ(request->getStart(), result->getStart());
+    EXPECT_EQ(request->getTarget(), result->getTarget());
+
+    EXPECT_THROW(converter.deserialize(wireSchema, "short"),
+            SerializationException);
+
+}
+
+TEST(ConverterTest, testEventIdListRoundtrip) {
+
+    EventIdListConverter converter;
+    EventIdListPtr ids(new EventIdList);
+    ids->push_back(EventId(rsc::misc::UUID(), 0));
+    ids->push_back(EventId(rsc::misc::UUID(), 0xfffffffe));
+
+    string wire;
+    string wireSchema = converter.serialize(
+            make_pair(converter.getDataType(), ids), wire);
+    EXPECT_EQ(EventIdListConverter::WIRE_SCHEMA, wireSchema);
+
+    EventIdListPtr result = boost::static_pointer_cast<EventIdList>(
+            converter.deserialize(wireSchema, wire).second);
+    EXPECT_EQ(*ids, *result);
+
+    EXPECT_THROW(converter.deserialize(wireSchema, wire.substr(1)),
+            SerializationException);
+
+}
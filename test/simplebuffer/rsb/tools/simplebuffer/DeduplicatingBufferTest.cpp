@@ -0,0 +1,98 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <rsb/MetaData.h>
+
+#include "rsb/tools/simplebuffer/DeduplicatingBuffer.h"
+#include "rsb/tools/simplebuffer/RingBuffer.h"
+
+#include "testhelpers.h"
+
+using namespace std;
+using namespace testing;
+using namespace rsb;
+using namespace rsb::tools::simplebuffer;
+
+TEST(DeduplicatingBufferTest, testSharesIdenticalPayloads) {
+
+    DeduplicatingBuffer buffer(BufferPtr(new RingBuffer(100)));
+
+    rsc::misc::UUID participant;
+    vector<EventPtr> inserted;
+    for (boost::uint32_t i = 0; i < 10; ++i) {
+        inserted.push_back(
+                createSerializedEvent(participant, i, i + 1,
+                        string(1000, i % 2 ? 'a' : 'b')));
+        buffer.insert(inserted.back());
+    }
+    // equal bytes with another schema must not be shared
+    EventPtr other = createSerializedEvent(participant, 10, 11,
+            string(1000, 'a'));
+    getSerializedPayload(other)->first = "other";
+    buffer.insert(other);
+    // too small to be considered
+    buffer.insert(createSerializedEvent(participant, 11, 12, "x"));
+
+    EXPECT_EQ(size_t(12), buffer.size());
+    EXPECT_EQ(size_t(3), buffer.getSharedPayloads());
+    EXPECT_EQ(
+            getSerializedPayload(buffer.get(EventId(participant, 1))).get(),
+            getSerializedPayload(buffer.get(EventId(participant, 9))).get());
+    EXPECT_NE(
+            getSerializedPayload(buffer.get(EventId(participant, 0))).get(),
+            getSerializedPayload(buffer.get(EventId(participant, 1))).get());
+    EXPECT_EQ("other",
+            getSerializedPayload(buffer.get(EventId(participant, 10)))->first);
+    // the inserted events are shared with other handlers and stay untouched
+    EXPECT_NE(getSerializedPayload(inserted[1]).get(),
+            getSerializedPayload(inserted[9]).get());
+    EXPECT_NE(inserted[9], buffer.get(EventId(participant, 9)));
+    EXPECT_EQ(boost::uint64_t(10 * 1006 + 1005), buffer.getInsertedBytes());
+    EXPECT_EQ(boost::uint64_t(2 * 1006 + 1005), buffer.getCopiedBytes());
+    EXPECT_DOUBLE_EQ(11065.0 / 3017.0, buffer.getDeduplicationRatio());
+
+}
+
+TEST(DeduplicatingBufferTest, testReleasesExpiredPayloads) {
+
+    DeduplicatingBuffer buffer(BufferPtr(new RingBuffer(100)));
+
+    rsc::misc::UUID participant;
+    buffer.insert(createSerializedEvent(participant, 0, 10, string(100, 'a')));
+    buffer.insert(createSerializedEvent(participant, 1, 100, string(100, 'b')));
+    EXPECT_EQ(size_t(2), buffer.getSharedPayloads());
+
+    buffer.removeOld(150);
+    EXPECT_EQ(size_t(1), buffer.getSharedPayloads());
+
+    // an expired payload is copied again
+    buffer.insert(createSerializedEvent(participant, 2, 160, string(100, 'a')));
+    EXPECT_EQ(boost::uint64_t(3 * 106), buffer.getCopiedBytes());
+
+}
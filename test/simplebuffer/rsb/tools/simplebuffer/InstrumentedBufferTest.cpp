@@ -0,0 +1,73 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <rsb/MetaData.h>
+
+#include "rsb/tools/simplebuffer/InstrumentedBuffer.h"
+#include "rsb/tools/simplebuffer/RingBuffer.h"
+
+using namespace std;
+using namespace testing;
+using namespace rsb;
+using namespace rsb::tools::simplebuffer;
+
+TEST(InstrumentedBufferTest, testCounts) {
+
+    InstrumentedBuffer buffer(BufferPtr(new RingBuffer(100)));
+    rsc::misc::UUID participant;
+    for (boost::uint32_t i = 0; i < 10; ++i) {
+        EventPtr event(new Event);
+        event->setId(participant, i);
+        event->setScope(Scope("/test"));
+        event->mutableMetaData().setDeliverTime(1 + 20 * i);
+        buffer.insert(event);
+    }
+
+    EXPECT_EQ(size_t(5), buffer.size());
+    EXPECT_TRUE(buffer.get(EventId(participant, 9)));
+    EXPECT_FALSE(buffer.get(EventId(participant, 0)));
+    EXPECT_FALSE(buffer.get(EventId(participant, 10)));
+    vector<EventPtr> events;
+    buffer.getRange(Scope("/test"), 0, 1000, events);
+    EXPECT_EQ(size_t(5), events.size());
+    buffer.removeOld(250);
+    EXPECT_EQ(size_t(2), buffer.size());
+
+    stringstream statistics;
+    buffer.printStatistics(statistics);
+    EXPECT_THAT(statistics.str(),
+            HasSubstr("stored=2 inserted=10 expired=3 evicted=5"));
+    EXPECT_THAT(statistics.str(), HasSubstr("hits=1 misses=2"));
+    EXPECT_THAT(statistics.str(), HasSubstr("ranges=1 rangeEvents=5"));
+    EXPECT_THAT(statistics.str(), HasSubstr("insert.p99="));
+    EXPECT_THAT(statistics.str(), HasSubstr("expiry.p999="));
+
+}
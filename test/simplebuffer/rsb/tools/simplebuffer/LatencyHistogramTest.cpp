@@ -0,0 +1,67 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "rsb/tools/simplebuffer/LatencyHistogram.h"
+
+using namespace std;
+using namespace testing;
+using namespace rsb::tools::simplebuffer;
+
+TEST(LatencyHistogramTest, testEmpty) {
+
+    LatencyHistogram histogram;
+    EXPECT_EQ(boost::uint64_t(0), histogram.getCount());
+    EXPECT_EQ(boost::uint64_t(0), histogram.getTotal());
+    EXPECT_EQ(boost::uint64_t(0), histogram.getQuantile(0.99));
+
+}
+
+TEST(LatencyHistogramTest, testQuantiles) {
+
+    LatencyHistogram histogram;
+    for (unsigned int i = 0; i < 990; ++i) {
+        histogram.record(3);
+    }
+    for (unsigned int i = 0; i < 9; ++i) {
+        histogram.record(100);
+    }
+    histogram.record(5000);
+
+    EXPECT_EQ(boost::uint64_t(1000), histogram.getCount());
+    EXPECT_EQ(boost::uint64_t(990 * 3 + 900 + 5000), histogram.getTotal());
+    EXPECT_EQ(boost::uint64_t(3), histogram.getQuantile(0.5));
+    EXPECT_EQ(boost::uint64_t(3), histogram.getQuantile(0.99));
+    EXPECT_EQ(boost::uint64_t(127), histogram.getQuantile(0.995));
+    EXPECT_EQ(boost::uint64_t(8191), histogram.getQuantile(1.0));
+    EXPECT_EQ(boost::uint64_t(3), histogram.getQuantile(0.0));
+
+    histogram.record(0);
+    EXPECT_EQ(boost::uint64_t(0), histogram.getQuantile(0.0));
+
+}
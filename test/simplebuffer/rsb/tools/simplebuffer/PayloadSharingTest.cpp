@@ -0,0 +1,135 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include <limits>
+#include <map>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <rsc/misc/langutils.h>
+
+#include <rsb/MetaData.h>
+
+#include <rsb/tools/timesync/StaticTimestampSelectors.h>
+
+#include "rsb/tools/simplebuffer/BatchRequestCallback.h"
+#include "rsb/tools/simplebuffer/BufferInsertHandler.h"
+#include "rsb/tools/simplebuffer/BufferRequestCallback.h"
+#include "rsb/tools/simplebuffer/ConcurrentReadBuffer.h"
+#include "rsb/tools/simplebuffer/DeduplicatingBuffer.h"
+#include "rsb/tools/simplebuffer/InstrumentedBuffer.h"
+#include "rsb/tools/simplebuffer/RangeRequestCallback.h"
+#include "rsb/tools/simplebuffer/RingBuffer.h"
+#include "rsb/tools/simplebuffer/ScopedBuffer.h"
+#include "rsb/tools/simplebuffer/SerializedPayload.h"
+#include "rsb/tools/simplebuffer/ShardedBuffer.h"
+#include "rsb/tools/simplebuffer/TimeBoundedBuffer.h"
+#include "rsb/tools/simplebuffer/TimeIndexedBuffer.h"
+#include "rsb/tools/simplebuffer/TimeRange.h"
+
+using namespace std;
+using namespace testing;
+using namespace rsb;
+using namespace rsb::tools::simplebuffer;
+
+namespace {
+
+/**
+ * Inserts a large event through the listener handler and verifies that all
+ * request paths reply with the very same payload object.
+ */
+void expectPayloadShared(BufferPtr buffer) {
+
+    rsc::misc::UUID participant;
+    SerializedPayloadPtr payload(
+            new SerializedPayload("schema", string(8 * 1024 * 1024, 'p')));
+    EventPtr event(new Event(Scope("/large"), payload,
+            rsc::runtime::typeName<SerializedPayload>()));
+    event->setId(participant, 0);
+    event->mutableMetaData().setDeliverTime(
+            rsc::misc::currentTimeMicros());
+
+    BufferInsertHandler(buffer).handle(event);
+
+    AnnotatedData reply = BufferRequestCallback(buffer).call("get",
+            boost::shared_ptr<EventId>(new EventId(participant, 0)));
+    EXPECT_EQ(rsc::runtime::typeName<SerializedPayload>(), reply.first);
+    EXPECT_EQ(payload.get(), reply.second.get());
+
+    EventIdListPtr ids(new EventIdList);
+    ids->push_back(EventId(participant, 0));
+    boost::shared_ptr<EventsByScopeMap> batch = BatchRequestCallback(buffer).call(
+            "getMany", ids);
+    ASSERT_EQ(size_t(1), (*batch)[Scope("/large")].size());
+    EXPECT_EQ(payload.get(), (*batch)[Scope("/large")].front()->getData().get());
+
+    boost::shared_ptr<EventsByScopeMap> range = RangeRequestCallback(buffer).call(
+            "getRange",
+            TimeRangePtr(
+                    new TimeRange(Scope("/"), 0,
+                            numeric_limits<boost::uint64_t>::max())));
+    ASSERT_EQ(size_t(1), (*range)[Scope("/large")].size());
+    EXPECT_EQ(payload.get(), (*range)[Scope("/large")].front()->getData().get());
+
+}
+
+}
+
+TEST(PayloadSharingTest, testMemoryBuffers) {
+    expectPayloadShared(BufferPtr(new RingBuffer(60000000)));
+    expectPayloadShared(BufferPtr(new TimeBoundedBuffer(60000000)));
+    expectPayloadShared(BufferPtr(new ConcurrentReadBuffer(60000000)));
+}
+
+TEST(PayloadSharingTest, testDecorators) {
+
+    vector<BufferPtr> shards;
+    shards.push_back(BufferPtr(new RingBuffer(60000000)));
+    shards.push_back(BufferPtr(new RingBuffer(60000000)));
+    expectPayloadShared(BufferPtr(new ShardedBuffer(shards)));
+
+    map<Scope, BufferPtr> buffers;
+    buffers[Scope("/")] = BufferPtr(new RingBuffer(60000000));
+    expectPayloadShared(BufferPtr(new ScopedBuffer(buffers)));
+
+    expectPayloadShared(
+            BufferPtr(
+                    new DeduplicatingBuffer(
+                            BufferPtr(new RingBuffer(60000000)))));
+    expectPayloadShared(
+            BufferPtr(
+                    new InstrumentedBuffer(
+                            BufferPtr(new RingBuffer(60000000)))));
+    expectPayloadShared(
+            BufferPtr(
+                    new TimeIndexedBuffer(BufferPtr(new RingBuffer(60000000)),
+                            rsb::tools::timesync::TimestampSelectorPtr(
+                                    new rsb::tools::timesync::DeliverTimestampSelector),
+                            60000000)));
+
+}
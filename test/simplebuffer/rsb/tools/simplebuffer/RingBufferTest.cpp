@@ -0,0 +1,236 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <rsb/MetaData.h>
+
+#include "rsb/tools/simplebuffer/RingBuffer.h"
+#include "rsb/tools/simplebuffer/SerializedPayload.h"
+
+#include "testhelpers.h"
+
+using namespace std;
+using namespace testing;
+using namespace rsb;
+using namespace rsb::tools::simplebuffer;
+
+TEST(RingBufferTest, testInsertAndGet) {
+
+    RingBuffer buffer(1000);
+    rsc::misc::UUID participant;
+
+    vector<EventPtr> events;
+    for (boost::uint32_t i = 0; i < 10; ++i) {
+        events.push_back(createEvent(participant, i, 1 + i));
+        buffer.insert(events.back());
+    }
+
+    EXPECT_EQ(size_t(10), buffer.size());
+    for (boost::uint32_t i = 0; i < 10; ++i) {
+        EXPECT_EQ(events[i], buffer.get(EventId(participant, i)));
+    }
+    EXPECT_FALSE(buffer.get(EventId(participant, 10)));
+    EXPECT_FALSE(buffer.get(EventId(rsc::misc::UUID(), 0)));
+
+}
+
+TEST(RingBufferTest, testExpiry) {
+
+    const boost::uint64_t delta = 100;
+    RingBuffer buffer(delta);
+    rsc::misc::UUID participant;
+
+    for (boost::uint32_t i = 0; i < 50; ++i) {
+        buffer.insert(createEvent(participant, i, 1 + 10 * i));
+    }
+
+    // the newest event was delivered at 491, hence all events delivered up to
+    // 391 must have been removed
+    EXPECT_EQ(size_t(10), buffer.size());
+    for (boost::uint32_t i = 0; i < 40; ++i) {
+        EXPECT_FALSE(buffer.get(EventId(participant, i))) << "Event " << i;
+    }
+    for (boost::uint32_t i = 40; i < 50; ++i) {
+        EXPECT_TRUE(buffer.get(EventId(participant, i))) << "Event " << i;
+    }
+
+}
+
+TEST(RingBufferTest, testRemoveOldWithoutInserts) {
+
+    RingBuffer buffer(100);
+    rsc::misc::UUID participant;
+
+    for (boost::uint32_t i = 0; i < 10; ++i) {
+        buffer.insert(createEvent(participant, i, 1 + 10 * i));
+    }
+    EXPECT_EQ(size_t(10), buffer.size());
+
+    buffer.removeOld(150);
+    EXPECT_EQ(size_t(5), buffer.size());
+    EXPECT_FALSE(buffer.get(EventId(participant, 4)));
+    EXPECT_TRUE(buffer.get(EventId(participant, 5)));
+
+    buffer.removeOld(1000);
+    EXPECT_EQ(size_t(0), buffer.size());
+
+}
+
+TEST(RingBufferTest, testGrowAndWrap) {
+
+    const boost::uint64_t delta = 1000;
+    RingBuffer buffer(delta, 4);
+    rsc::misc::UUID participantA;
+    rsc::misc::UUID participantB;
+
+    // interleave two participants and keep the ring wrapping around while it
+    // grows to make index relocation and deletion shifting happen
+    boost::uint64_t time = 1;
+    for (boost::uint32_t i = 0; i < 5000; ++i) {
+        buffer.insert(createEvent(participantA, i, time));
+        buffer.insert(createEvent(participantB, i, time));
+        time += 7;
+    }
+
+    boost::uint64_t newest = time - 7;
+    for (boost::uint32_t i = 0; i < 5000; ++i) {
+        boost::uint64_t deliverTime = 1 + 7 * boost::uint64_t(i);
+        bool expected = deliverTime + delta > newest;
+        EXPECT_EQ(expected, bool(buffer.get(EventId(participantA, i))))
+            << "Event " << i;
+        EXPECT_EQ(expected, bool(buffer.get(EventId(participantB, i))))
+            << "Event " << i;
+    }
+
+}
+
+TEST(RingBufferTest, testGetRange) {
+
+    RingBuffer buffer(1000000);
+    rsc::misc::UUID participant;
+
+    for (boost::uint32_t i = 0; i < 100; ++i) {
+        EventPtr event = createEvent(participant, i, 1000 + 10 * i);
+        event->setScope(i % 2 == 0 ? Scope("/test/even") : Scope("/test/odd"));
+        buffer.insert(event);
+    }
+
+    vector<EventPtr> events;
+    buffer.getRange(Scope("/test/even"), 1100, 1300, events);
+    ASSERT_EQ(size_t(11), events.size());
+    for (size_t i = 0; i < events.size(); ++i) {
+        EXPECT_EQ(EventId(participant, 10 + 2 * i), events[i]->getId());
+    }
+
+    events.clear();
+    buffer.getRange(Scope("/test"), 1985, 100000, events);
+    ASSERT_EQ(size_t(1), events.size());
+    EXPECT_EQ(EventId(participant, 99), events.front()->getId());
+
+    events.clear();
+    buffer.getRange(Scope("/other"), 0, 100000, events);
+    EXPECT_TRUE(events.empty());
+
+}
+
+TEST(RingBufferTest, testDuplicateIgnored) {
+
+    RingBuffer buffer(1000);
+    rsc::misc::UUID participant;
+
+    EventPtr first = createEvent(participant, 0, 1);
+    buffer.insert(first);
+    buffer.insert(createEvent(participant, 0, 2));
+
+    EXPECT_EQ(size_t(1), buffer.size());
+    EXPECT_EQ(first, buffer.get(EventId(participant, 0)));
+
+}
+
+TEST(RingBufferTest, testByteBudget) {
+
+    RingBuffer buffer(1000000, 1024, 1000);
+    rsc::misc::UUID participant;
+
+    for (boost::uint32_t i = 0; i < 10; ++i) {
+        EventPtr event = createEvent(participant, i, 1 + i);
+        event->setType(rsc::runtime::typeName<SerializedPayload>());
+        event->setData(
+                SerializedPayloadPtr(
+                        new SerializedPayload("schema", string(244, 'x'))));
+        buffer.insert(event);
+    }
+
+    // each event has 250 bytes, so only the latest four fit
+    EXPECT_EQ(size_t(4), buffer.size());
+    EXPECT_EQ(boost::uint64_t(1000), buffer.getStoredBytes());
+    EXPECT_EQ(boost::uint64_t(6), buffer.getEvictedEvents());
+    EXPECT_EQ(boost::uint64_t(1500), buffer.getEvictedBytes());
+    EXPECT_FALSE(buffer.get(EventId(participant, 5)));
+    EXPECT_TRUE(buffer.get(EventId(participant, 6)));
+
+    EventPtr tooLarge = createEvent(participant, 10, 11);
+    tooLarge->setType(rsc::runtime::typeName<SerializedPayload>());
+    tooLarge->setData(
+            SerializedPayloadPtr(
+                    new SerializedPayload("schema", string(2000, 'x'))));
+    buffer.insert(tooLarge);
+    EXPECT_FALSE(buffer.get(tooLarge->getId()));
+    EXPECT_EQ(size_t(4), buffer.size());
+    EXPECT_EQ(boost::uint64_t(7), buffer.getEvictedEvents());
+
+}
+
+TEST(RingBufferTest, testGetRangeWithOutOfOrderEvents) {
+
+    RingBuffer buffer(1000);
+    rsc::misc::UUID participant;
+
+    // the late events 3 and 4 follow event 2 which was delivered after the
+    // end of the requested range
+    const boost::uint64_t deliverTimes[] = { 10, 20, 50, 30, 15, 60 };
+    for (boost::uint32_t i = 0; i < 6; ++i) {
+        buffer.insert(createEvent(participant, i, deliverTimes[i]));
+    }
+
+    vector<EventPtr> events;
+    buffer.getRange(Scope("/test"), 12, 40, events);
+    ASSERT_EQ(size_t(3), events.size());
+    EXPECT_EQ(EventId(participant, 4), events[0]->getId());
+    EXPECT_EQ(EventId(participant, 1), events[1]->getId());
+    EXPECT_EQ(EventId(participant, 3), events[2]->getId());
+
+    events.clear();
+    buffer.getRange(Scope("/test"), 0, 100, events);
+    ASSERT_EQ(size_t(6), events.size());
+    for (size_t i = 1; i < events.size(); ++i) {
+        EXPECT_LE(events[i - 1]->getMetaData().getDeliverTime(),
+                events[i]->getMetaData().getDeliverTime());
+    }
+
+}
@@ -0,0 +1,80 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "rsb/tools/simplebuffer/ScopeRetention.h"
+
+using namespace std;
+using namespace testing;
+using namespace rsb;
+using namespace rsb::tools::simplebuffer;
+
+TEST(ScopeRetentionTest, testDefaults) {
+
+    ScopeRetention retention = ScopeRetention::parse("/camera", 42, 23);
+    EXPECT_EQ(Scope("/camera"), retention.getScope());
+    EXPECT_EQ(boost::uint64_t(42), retention.getTimeMuSec());
+    EXPECT_EQ(boost::uint64_t(23), retention.getMaxBytes());
+
+}
+
+TEST(ScopeRetentionTest, testUnits) {
+
+    EXPECT_EQ(boost::uint64_t(500),
+            ScopeRetention::parse("/a:500", 0, 0).getTimeMuSec());
+    EXPECT_EQ(boost::uint64_t(500),
+            ScopeRetention::parse("/a:500us", 0, 0).getTimeMuSec());
+    EXPECT_EQ(boost::uint64_t(500000),
+            ScopeRetention::parse("/a:500ms", 0, 0).getTimeMuSec());
+    EXPECT_EQ(boost::uint64_t(10000000),
+            ScopeRetention::parse("/a:10s", 0, 0).getTimeMuSec());
+    EXPECT_EQ(boost::uint64_t(120000000),
+            ScopeRetention::parse("/a:2min", 0, 0).getTimeMuSec());
+
+    ScopeRetention retention = ScopeRetention::parse("/a/b:1s:512M", 0, 7);
+    EXPECT_EQ(Scope("/a/b"), retention.getScope());
+    EXPECT_EQ(boost::uint64_t(512) << 20, retention.getMaxBytes());
+    EXPECT_EQ(boost::uint64_t(3) << 10,
+            ScopeRetention::parse("/a:1s:3K", 0, 0).getMaxBytes());
+    EXPECT_EQ(boost::uint64_t(1) << 30,
+            ScopeRetention::parse("/a:1s:1G", 0, 0).getMaxBytes());
+    EXPECT_EQ(boost::uint64_t(100),
+            ScopeRetention::parse("/a:1s:100", 0, 0).getMaxBytes());
+
+}
+
+TEST(ScopeRetentionTest, testInvalid) {
+
+    EXPECT_THROW(ScopeRetention::parse("/a:", 0, 0), invalid_argument);
+    EXPECT_THROW(ScopeRetention::parse("/a:10h", 0, 0), invalid_argument);
+    EXPECT_THROW(ScopeRetention::parse("/a:ms", 0, 0), invalid_argument);
+    EXPECT_THROW(ScopeRetention::parse("/a:1s:10T", 0, 0), invalid_argument);
+
+}
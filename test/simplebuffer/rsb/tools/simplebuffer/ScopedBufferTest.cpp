@@ -0,0 +1,104 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <rsb/MetaData.h>
+
+#include "rsb/tools/simplebuffer/RingBuffer.h"
+#include "rsb/tools/simplebuffer/ScopedBuffer.h"
+
+#include "testhelpers.h"
+
+using namespace std;
+using namespace testing;
+using namespace rsb;
+using namespace rsb::tools::simplebuffer;
+
+TEST(ScopedBufferTest, testRetentionPerScope) {
+
+    boost::shared_ptr<RingBuffer> camera(new RingBuffer(50));
+    boost::shared_ptr<RingBuffer> odometry(new RingBuffer(1000));
+    boost::shared_ptr<RingBuffer> leftCamera(new RingBuffer(1000));
+    map<Scope, BufferPtr> buffers;
+    buffers[Scope("/camera")] = camera;
+    buffers[Scope("/camera/left")] = leftCamera;
+    buffers[Scope("/odometry")] = odometry;
+    ScopedBuffer buffer(buffers);
+
+    rsc::misc::UUID participant;
+    buffer.insert(createEvent(Scope("/camera/right"), participant, 0, 100));
+    buffer.insert(createEvent(Scope("/camera/left/raw"), participant, 1, 100));
+    buffer.insert(createEvent(Scope("/odometry"), participant, 2, 100));
+    buffer.insert(createEvent(Scope("/unknown"), participant, 3, 100));
+
+    EXPECT_EQ(size_t(1), camera->size());
+    EXPECT_EQ(size_t(1), leftCamera->size());
+    EXPECT_EQ(size_t(1), odometry->size());
+    EXPECT_FALSE(buffer.get(EventId(participant, 3)));
+
+    buffer.removeOld(200);
+    EXPECT_FALSE(buffer.get(EventId(participant, 0)));
+    EXPECT_TRUE(buffer.get(EventId(participant, 1)));
+    EXPECT_TRUE(buffer.get(EventId(participant, 2)));
+
+}
+
+TEST(ScopedBufferTest, testGetRangeMerges) {
+
+    map<Scope, BufferPtr> buffers;
+    buffers[Scope("/a")] = BufferPtr(new RingBuffer(1000));
+    buffers[Scope("/a/b")] = BufferPtr(new RingBuffer(1000));
+    buffers[Scope("/c")] = BufferPtr(new RingBuffer(1000));
+    ScopedBuffer buffer(buffers);
+
+    rsc::misc::UUID participant;
+    for (boost::uint32_t i = 0; i < 30; ++i) {
+        const char *scopes[] = { "/a", "/a/b", "/c" };
+        buffer.insert(
+                createEvent(Scope(scopes[i % 3]), participant, i, i + 1));
+    }
+
+    vector<EventPtr> events;
+    buffer.getRange(Scope("/a"), 0, 100, events);
+    ASSERT_EQ(size_t(20), events.size());
+    for (size_t i = 1; i < events.size(); ++i) {
+        EXPECT_LT(events[i - 1]->getMetaData().getDeliverTime(),
+                events[i]->getMetaData().getDeliverTime());
+    }
+
+    events.clear();
+    buffer.getRange(Scope("/a/b"), 0, 100, events);
+    EXPECT_EQ(size_t(10), events.size());
+
+}
+
+TEST(ScopedBufferTest, testRequiresScopes) {
+    EXPECT_THROW(ScopedBuffer(map<Scope, BufferPtr>()), invalid_argument);
+}
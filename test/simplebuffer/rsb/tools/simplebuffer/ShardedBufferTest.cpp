@@ -0,0 +1,76 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <rsb/MetaData.h>
+
+#include "rsb/tools/simplebuffer/RingBuffer.h"
+#include "rsb/tools/simplebuffer/ShardedBuffer.h"
+
+using namespace std;
+using namespace testing;
+using namespace rsb;
+using namespace rsb::tools::simplebuffer;
+
+TEST(ShardedBufferTest, testDistributesAndFinds) {
+
+    vector<boost::shared_ptr<RingBuffer> > rings;
+    vector<BufferPtr> shards;
+    for (unsigned int i = 0; i < 4; ++i) {
+        rings.push_back(boost::shared_ptr<RingBuffer>(new RingBuffer(1000000)));
+        shards.push_back(rings.back());
+    }
+    ShardedBuffer buffer(shards);
+
+    rsc::misc::UUID participant;
+    const boost::uint32_t numEvents = 400;
+    for (boost::uint32_t i = 0; i < numEvents; ++i) {
+        EventPtr event(new Event);
+        event->setId(participant, i);
+        event->mutableMetaData().setDeliverTime(1 + i);
+        buffer.insert(event);
+    }
+
+    for (boost::uint32_t i = 0; i < numEvents; ++i) {
+        EventId id(participant, i);
+        ASSERT_TRUE(buffer.get(id)) << "Event " << i;
+        EXPECT_TRUE(buffer.shardFor(id)->get(id));
+    }
+
+    for (unsigned int i = 0; i < rings.size(); ++i) {
+        EXPECT_GT(rings[i]->size(), size_t(numEvents / 8))
+            << "Shard " << i << " is heavily underused";
+    }
+
+}
+
+TEST(ShardedBufferTest, testRequiresShards) {
+    EXPECT_THROW(ShardedBuffer(vector<BufferPtr>()), invalid_argument);
+}
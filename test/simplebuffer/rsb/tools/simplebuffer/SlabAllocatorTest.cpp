@@ -0,0 +1,84 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include <map>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "rsb/tools/simplebuffer/SlabAllocator.h"
+#include "rsb/tools/simplebuffer/SlabArena.h"
+#include "rsb/tools/simplebuffer/SlabPool.h"
+
+using namespace std;
+using namespace testing;
+using namespace rsb::tools::simplebuffer;
+
+TEST(SlabAllocatorTest, testPoolReusesChunks) {
+
+    SlabPool pool(20, 4);
+    EXPECT_EQ(size_t(0), pool.getChunkSize() % (2 * sizeof(void*)));
+    EXPECT_LE(size_t(20), pool.getChunkSize());
+
+    void *first = pool.allocate();
+    void *second = pool.allocate();
+    EXPECT_NE(first, second);
+    EXPECT_EQ(size_t(1), pool.getSlabCount());
+
+    pool.deallocate(first);
+    EXPECT_EQ(first, pool.allocate());
+
+    for (unsigned int i = 0; i < 3; ++i) {
+        pool.allocate();
+    }
+    EXPECT_EQ(size_t(2), pool.getSlabCount());
+
+}
+
+TEST(SlabAllocatorTest, testSteadyStateMapDoesNotGrow) {
+
+    typedef map<int, int, less<int>, SlabAllocator<pair<const int, int> > > Map;
+
+    SlabArena arena;
+    Map::allocator_type allocator(arena);
+    Map values(less<int>(), allocator);
+
+    // sliding window of 1000 entries like in a time bounded buffer
+    for (int i = 0; i < 1000; ++i) {
+        values.insert(make_pair(i, i));
+    }
+    size_t slabs = arena.getSlabCount();
+    EXPECT_LT(size_t(0), slabs);
+
+    for (int i = 1000; i < 100000; ++i) {
+        values.insert(make_pair(i, i));
+        values.erase(i - 1000);
+    }
+    EXPECT_EQ(slabs, arena.getSlabCount());
+    EXPECT_EQ(size_t(1000), values.size());
+    EXPECT_EQ(99999, values.rbegin()->second);
+
+}
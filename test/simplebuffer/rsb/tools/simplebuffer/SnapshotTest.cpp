@@ -0,0 +1,177 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <rsb/MetaData.h>
+
+#include "rsb/tools/simplebuffer/RingBuffer.h"
+#include "rsb/tools/simplebuffer/SerializedPayload.h"
+#include "rsb/tools/simplebuffer/Snapshot.h"
+
+#include "testhelpers.h"
+
+using namespace std;
+using namespace testing;
+using namespace rsb;
+using namespace rsb::tools::simplebuffer;
+
+namespace {
+
+EventPtr createCapturedEvent(const rsc::misc::UUID &participant,
+        const boost::uint32_t &sequenceNumber,
+        const boost::uint64_t &deliverTime) {
+    EventPtr event = createSerializedEvent(participant, sequenceNumber,
+            deliverTime, string(100, char(sequenceNumber)));
+    event->mutableMetaData().setUserTime("capture", deliverTime - 5);
+    return event;
+}
+
+string snapshotPath() {
+    return TempDir() + "simplebuffer-snapshot";
+}
+
+}
+
+TEST(SnapshotTest, testRoundtripSkipsExpired) {
+
+    BufferPtr original(new RingBuffer(1000));
+    rsc::misc::UUID participant;
+    for (boost::uint32_t i = 0; i < 10; ++i) {
+        original->insert(createCapturedEvent(participant, i, 100 + 10 * i));
+    }
+    // not serializable, thus skipped
+    EventPtr converted(new Event);
+    converted->setId(participant, 10);
+    converted->setScope(Scope("/test"));
+    converted->mutableMetaData().setDeliverTime(200);
+    original->insert(converted);
+
+    EXPECT_EQ(size_t(10), saveSnapshot(original, snapshotPath()));
+
+    BufferPtr restored(new RingBuffer(1000));
+    EXPECT_EQ(size_t(7), loadSnapshot(snapshotPath(), restored, 130));
+    EXPECT_EQ(size_t(7), restored->size());
+    EXPECT_FALSE(restored->get(EventId(participant, 2)));
+
+    EventPtr event = restored->get(EventId(participant, 5));
+    ASSERT_TRUE(event);
+    EXPECT_EQ(Scope("/test"), *event->getScopePtr());
+    EXPECT_EQ(boost::uint64_t(150), event->getMetaData().getDeliverTime());
+    EXPECT_EQ(boost::uint64_t(145),
+            event->getMetaData().getUserTime("capture"));
+    EXPECT_EQ(string(100, char(5)), getSerializedPayload(event)->second);
+
+    remove(snapshotPath().c_str());
+
+}
+
+TEST(SnapshotTest, testTruncatedSnapshot) {
+
+    BufferPtr original(new RingBuffer(1000));
+    rsc::misc::UUID participant;
+    for (boost::uint32_t i = 0; i < 3; ++i) {
+        original->insert(createCapturedEvent(participant, i, 100 + i));
+    }
+    saveSnapshot(original, snapshotPath());
+
+    ifstream in(snapshotPath().c_str(), ios::binary);
+    string contents((istreambuf_iterator<char>(in)),
+            istreambuf_iterator<char>());
+    in.close();
+    ofstream out(snapshotPath().c_str(), ios::binary | ios::trunc);
+    out.write(contents.data(), contents.size() - 10);
+    out.close();
+
+    BufferPtr restored(new RingBuffer(1000));
+    EXPECT_EQ(size_t(2), loadSnapshot(snapshotPath(), restored, 0));
+
+    remove(snapshotPath().c_str());
+
+}
+
+TEST(SnapshotTest, testDamagedRecords) {
+
+    BufferPtr original(new RingBuffer(1000));
+    rsc::misc::UUID participant;
+    for (boost::uint32_t i = 0; i < 3; ++i) {
+        original->insert(createCapturedEvent(participant, i, 100 + i));
+    }
+    saveSnapshot(original, snapshotPath());
+
+    ifstream in(snapshotPath().c_str(), ios::binary);
+    const string contents((istreambuf_iterator<char>(in)),
+            istreambuf_iterator<char>());
+    in.close();
+    // magic, record header, event id and length of the scope
+    const size_t scopeOffset = 8 + 12 + 20 + 4;
+
+    // an invalid scope of the first record
+    string damaged = contents;
+    damaged[scopeOffset] = 'x';
+    {
+        ofstream out(snapshotPath().c_str(), ios::binary | ios::trunc);
+        out.write(damaged.data(), damaged.size());
+    }
+    EXPECT_THROW(
+            loadSnapshot(snapshotPath(), BufferPtr(new RingBuffer(1000)), 0),
+            runtime_error);
+
+    // a garbage length of the first record
+    damaged = contents;
+    damaged.replace(8, 4, "\xf0\xff\xff\xff", 4);
+    {
+        ofstream out(snapshotPath().c_str(), ios::binary | ios::trunc);
+        out.write(damaged.data(), damaged.size());
+    }
+    EXPECT_EQ(size_t(0),
+            loadSnapshot(snapshotPath(), BufferPtr(new RingBuffer(1000)), 0));
+
+    remove(snapshotPath().c_str());
+
+}
+
+TEST(SnapshotTest, testRejectsOtherFiles) {
+
+    {
+        ofstream out(snapshotPath().c_str(), ios::binary | ios::trunc);
+        out << "no snapshot";
+    }
+    EXPECT_THROW(
+            loadSnapshot(snapshotPath(), BufferPtr(new RingBuffer(1000)), 0),
+            runtime_error);
+    remove(snapshotPath().c_str());
+
+    EXPECT_THROW(
+            loadSnapshot(snapshotPath(), BufferPtr(new RingBuffer(1000)), 0),
+            runtime_error);
+
+}
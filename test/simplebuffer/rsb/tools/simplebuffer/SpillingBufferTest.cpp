@@ -0,0 +1,158 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <rsb/MetaData.h>
+
+#include "rsb/tools/simplebuffer/RingBuffer.h"
+#include "rsb/tools/simplebuffer/SerializedPayload.h"
+#include "rsb/tools/simplebuffer/SpillingBuffer.h"
+
+#include "testhelpers.h"
+
+using namespace std;
+using namespace testing;
+using namespace rsb;
+using namespace rsb::tools::simplebuffer;
+
+namespace {
+
+EventPtr createSpillableEvent(const rsc::misc::UUID &participant,
+        const boost::uint32_t &sequenceNumber,
+        const boost::uint64_t &deliverTime) {
+    EventPtr event = createSerializedEvent(participant, sequenceNumber,
+            deliverTime, string(100, char(sequenceNumber)));
+    event->mutableMetaData().setCreateTime(deliverTime - 3);
+    event->mutableMetaData().setUserInfo("key", "value");
+    return event;
+}
+
+}
+
+TEST(SpillingBufferTest, testGetFromDisk) {
+
+    rsc::misc::UUID participant;
+    SpillingBuffer buffer(BufferPtr(new RingBuffer(100)), 100, 10000,
+            TempDir(), 4096, 64);
+
+    for (boost::uint32_t i = 0; i < 100; ++i) {
+        EventPtr event = createSpillableEvent(participant, i, 1000 + 10 * i);
+        if (i == 0) {
+            event->addCause(EventId(participant, 1234));
+        }
+        buffer.insert(event);
+    }
+
+    // 100 events with more than 100 bytes do not fit into a single segment
+    EXPECT_LT(size_t(2), buffer.getSegmentCount());
+
+    for (boost::uint32_t i = 0; i < 100; ++i) {
+        EventPtr event = buffer.get(EventId(participant, i));
+        ASSERT_TRUE(event);
+        EXPECT_EQ(EventId(participant, i), event->getId());
+        EXPECT_EQ(Scope("/test"), event->getScope());
+        EXPECT_EQ(boost::uint64_t(1000 + 10 * i),
+                event->getMetaData().getDeliverTime());
+        EXPECT_EQ(boost::uint64_t(997 + 10 * i),
+                event->getMetaData().getCreateTime());
+        EXPECT_EQ("value", event->getMetaData().getUserInfo("key"));
+        SerializedPayloadPtr payload = getSerializedPayload(event);
+        ASSERT_TRUE(payload);
+        EXPECT_EQ("schema", payload->first);
+        EXPECT_EQ(string(100, char(i)), payload->second);
+    }
+    EXPECT_TRUE(
+            buffer.get(EventId(participant, 0))->isCause(
+                    EventId(participant, 1234)));
+    EXPECT_FALSE(buffer.get(EventId(participant, 100)));
+
+}
+
+TEST(SpillingBufferTest, testGetRangeAcrossTiers) {
+
+    rsc::misc::UUID participant;
+    SpillingBuffer buffer(BufferPtr(new RingBuffer(100)), 100, 10000,
+            TempDir(), 4096, 64);
+
+    for (boost::uint32_t i = 0; i < 100; ++i) {
+        buffer.insert(createSpillableEvent(participant, i, 1000 + 10 * i));
+    }
+
+    vector<EventPtr> events;
+    buffer.getRange(Scope("/"), 1500, 100000, events);
+    ASSERT_EQ(size_t(50), events.size());
+    for (size_t i = 0; i < events.size(); ++i) {
+        EXPECT_EQ(EventId(participant, 50 + i), events[i]->getId());
+    }
+
+    events.clear();
+    buffer.getRange(Scope("/other"), 0, 100000, events);
+    EXPECT_TRUE(events.empty());
+
+}
+
+TEST(SpillingBufferTest, testGetRangeWithOutOfOrderEvents) {
+
+    rsc::misc::UUID participant;
+    SpillingBuffer buffer(BufferPtr(new RingBuffer(100)), 100, 10000,
+            TempDir(), 4096, 64);
+
+    // pairs of events arrive in reversed order and are spilled like this
+    for (boost::uint32_t i = 0; i < 100; ++i) {
+        buffer.insert(
+                createSpillableEvent(participant, i, 1000 + 10 * (i ^ 1)));
+    }
+    EXPECT_LT(size_t(2), buffer.getSegmentCount());
+
+    vector<EventPtr> events;
+    buffer.getRange(Scope("/"), 0, 100000, events);
+    ASSERT_EQ(size_t(100), events.size());
+    for (boost::uint32_t i = 0; i < events.size(); ++i) {
+        EXPECT_EQ(EventId(participant, i ^ 1), events[i]->getId());
+    }
+
+}
+
+TEST(SpillingBufferTest, testSegmentsExpire) {
+
+    rsc::misc::UUID participant;
+    SpillingBuffer buffer(BufferPtr(new RingBuffer(100)), 100, 500,
+            TempDir(), 4096, 64);
+
+    for (boost::uint32_t i = 0; i < 100; ++i) {
+        buffer.insert(createSpillableEvent(participant, i, 1000 + 10 * i));
+    }
+    EXPECT_FALSE(buffer.get(EventId(participant, 0)));
+    EXPECT_TRUE(buffer.get(EventId(participant, 60)));
+    EXPECT_TRUE(buffer.get(EventId(participant, 99)));
+
+    buffer.removeOld(1000000);
+    EXPECT_EQ(size_t(0), buffer.getSegmentCount());
+    EXPECT_FALSE(buffer.get(EventId(participant, 99)));
+
+}
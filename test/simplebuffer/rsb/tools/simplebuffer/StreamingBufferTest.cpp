@@ -0,0 +1,192 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/thread.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <rsb/MetaData.h>
+
+#include "rsb/tools/simplebuffer/RingBuffer.h"
+#include "rsb/tools/simplebuffer/StreamingBuffer.h"
+
+#include "testhelpers.h"
+
+using namespace std;
+using namespace testing;
+using namespace rsb;
+using namespace rsb::tools::simplebuffer;
+
+namespace {
+
+/**
+ * Collects published events instead of sending them.
+ */
+class RecordingStreamingBuffer: public StreamingBuffer {
+public:
+
+    RecordingStreamingBuffer(BufferPtr buffer,
+            const set<Scope> &bufferedScopes = set<Scope>()) :
+            StreamingBuffer(buffer, ParticipantConfig(), bufferedScopes) {
+    }
+
+    ~RecordingStreamingBuffer() {
+        unsubscribeAll();
+    }
+
+    vector<EventPtr> waitForEvents(const size_t &count) {
+        boost::mutex::scoped_lock lock(mutex);
+        while (events.size() < count) {
+            published.wait(lock);
+        }
+        return events;
+    }
+
+protected:
+
+    InformerBasePtr createInformer(const Scope &/*target*/) {
+        return InformerBasePtr();
+    }
+
+    void publish(InformerBasePtr /*informer*/, EventPtr event) {
+        boost::mutex::scoped_lock lock(mutex);
+        events.push_back(event);
+        published.notify_all();
+    }
+
+private:
+
+    boost::mutex mutex;
+    boost::condition_variable published;
+    vector<EventPtr> events;
+
+};
+
+EventPtr createStringEvent(const Scope &scope,
+        const rsc::misc::UUID &participant,
+        const boost::uint32_t &sequenceNumber,
+        const boost::uint64_t &deliverTime) {
+    EventPtr event = createEvent(scope, participant, sequenceNumber,
+            deliverTime);
+    event->setType("string");
+    event->setData(boost::shared_ptr<string>(new string("payload")));
+    return event;
+}
+
+}
+
+TEST(StreamingBufferTest, testReplayThenFollow) {
+
+    RecordingStreamingBuffer buffer(BufferPtr(new RingBuffer(1000)));
+
+    rsc::misc::UUID participant;
+    for (boost::uint32_t i = 0; i < 5; ++i) {
+        buffer.insert(
+                createStringEvent(Scope("/a/b"), participant, i,
+                        10 * (i + 1)));
+    }
+    buffer.insert(createStringEvent(Scope("/c"), participant, 5, 60));
+
+    buffer.subscribe(ReplayRequest(Scope("/a"), 30, Scope("/client")));
+    EXPECT_EQ(size_t(1), buffer.getSubscriptionCount());
+
+    buffer.insert(createStringEvent(Scope("/c"), participant, 6, 70));
+    buffer.insert(createStringEvent(Scope("/a"), participant, 7, 80));
+
+    vector<EventPtr> events = buffer.waitForEvents(4);
+    ASSERT_EQ(size_t(4), events.size());
+    const boost::uint32_t expected[] = { 2, 3, 4, 7 };
+    for (size_t i = 0; i < events.size(); ++i) {
+        EXPECT_TRUE(events[i]->isCause(EventId(participant, expected[i])));
+        EXPECT_EQ("string", events[i]->getType());
+    }
+    EXPECT_EQ(Scope("/client/a/b"), *events[0]->getScopePtr());
+    EXPECT_EQ(boost::uint64_t(30), events[0]->getMetaData().getDeliverTime());
+    EXPECT_EQ(Scope("/client/a"), *events[3]->getScopePtr());
+
+    EXPECT_TRUE(buffer.unsubscribe(Scope("/client")));
+    EXPECT_FALSE(buffer.unsubscribe(Scope("/client")));
+    buffer.insert(createStringEvent(Scope("/a"), participant, 8, 90));
+    EXPECT_EQ(size_t(4), buffer.waitForEvents(4).size());
+    EXPECT_EQ(size_t(9), buffer.size());
+
+}
+
+TEST(StreamingBufferTest, testRejectsDuplicateTargets) {
+
+    RecordingStreamingBuffer buffer(BufferPtr(new RingBuffer(1000)));
+
+    buffer.subscribe(ReplayRequest(Scope("/a"), 0, Scope("/client")));
+    EXPECT_THROW(
+            buffer.subscribe(ReplayRequest(Scope("/b"), 0, Scope("/client"))),
+            invalid_argument);
+    buffer.subscribe(ReplayRequest(Scope("/b"), 0, Scope("/other")));
+    EXPECT_EQ(size_t(2), buffer.getSubscriptionCount());
+
+    EXPECT_TRUE(buffer.unsubscribe(Scope("/client")));
+    EXPECT_TRUE(buffer.unsubscribe(Scope("/other")));
+
+}
+
+TEST(StreamingBufferTest, testRejectsOverlappingTargets) {
+
+    set<Scope> bufferedScopes;
+    bufferedScopes.insert(Scope("/sensors/camera"));
+    RecordingStreamingBuffer buffer(BufferPtr(new RingBuffer(1000)),
+            bufferedScopes);
+
+    // target on or below the requested scope
+    EXPECT_THROW(buffer.subscribe(ReplayRequest(Scope("/a"), 0, Scope("/a"))),
+            invalid_argument);
+    EXPECT_THROW(
+            buffer.subscribe(ReplayRequest(Scope("/a"), 0, Scope("/a/client"))),
+            invalid_argument);
+    // requested scope below the target
+    EXPECT_THROW(
+            buffer.subscribe(ReplayRequest(Scope("/client/a"), 0, Scope("/client"))),
+            invalid_argument);
+    // target on, below or above a buffered scope
+    EXPECT_THROW(
+            buffer.subscribe(ReplayRequest(Scope("/a"), 0, Scope("/sensors/camera"))),
+            invalid_argument);
+    EXPECT_THROW(
+            buffer.subscribe(ReplayRequest(Scope("/a"), 0, Scope("/sensors/camera/client"))),
+            invalid_argument);
+    EXPECT_THROW(
+            buffer.subscribe(ReplayRequest(Scope("/a"), 0, Scope("/sensors"))),
+            invalid_argument);
+    EXPECT_EQ(size_t(0), buffer.getSubscriptionCount());
+
+    buffer.subscribe(ReplayRequest(Scope("/sensors/camera"), 0, Scope("/client")));
+    buffer.subscribe(ReplayRequest(Scope("/a"), 0, Scope("/sensors/laser")));
+    EXPECT_EQ(size_t(2), buffer.getSubscriptionCount());
+
+}
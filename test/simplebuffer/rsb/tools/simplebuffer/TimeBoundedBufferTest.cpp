@@ -0,0 +1,103 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <rsb/MetaData.h>
+
+#include "rsb/tools/simplebuffer/SerializedPayload.h"
+#include "rsb/tools/simplebuffer/TimeBoundedBuffer.h"
+
+#include "testhelpers.h"
+
+using namespace std;
+using namespace testing;
+using namespace rsb;
+using namespace rsb::tools::simplebuffer;
+
+namespace {
+
+EventPtr createCompressibleEvent(const rsc::misc::UUID &participant,
+        const boost::uint32_t &sequenceNumber,
+        const boost::uint64_t &deliverTime) {
+    string bytes;
+    for (unsigned int i = 0; i < 100; ++i) {
+        bytes += "status=ok ";
+    }
+    EventPtr event = createSerializedEvent(participant, sequenceNumber,
+            deliverTime, bytes);
+    event->mutableMetaData().setUserInfo("key", "value");
+    return event;
+}
+
+}
+
+TEST(TimeBoundedBufferTest, testCompressesOldPayloads) {
+
+    TimeBoundedBuffer buffer(1000, false, 100);
+
+    rsc::misc::UUID participant;
+    vector<EventPtr> inserted;
+    for (boost::uint32_t i = 0; i < 10; ++i) {
+        inserted.push_back(
+                createCompressibleEvent(participant, i, 10 + 10 * i));
+        buffer.insert(inserted.back());
+    }
+
+    buffer.removeOld(150);
+    EXPECT_EQ(size_t(10), buffer.size());
+    EXPECT_EQ(boost::uint64_t(5 * 1000), buffer.getUncompressedBytes());
+    EXPECT_LT(buffer.getCompressedBytes(), boost::uint64_t(5 * 100));
+
+    // the inserted events are left untouched
+    EXPECT_EQ(rsc::runtime::typeName<SerializedPayload>(),
+            inserted[0]->getType());
+
+    for (boost::uint32_t i = 0; i < 10; ++i) {
+        EventPtr event = buffer.get(EventId(participant, i));
+        ASSERT_TRUE(event);
+        EXPECT_EQ(rsc::runtime::typeName<SerializedPayload>(),
+                event->getType());
+        EXPECT_EQ(*getSerializedPayload(inserted[i]),
+                *getSerializedPayload(event));
+        EXPECT_EQ("value", event->getMetaData().getUserInfo("key"));
+        EXPECT_EQ(10 + 10 * i, event->getMetaData().getDeliverTime());
+    }
+
+    vector<EventPtr> events;
+    buffer.getRange(Scope("/"), 0, 1000, events);
+    ASSERT_EQ(size_t(10), events.size());
+    EXPECT_EQ(*getSerializedPayload(inserted[0]),
+            *getSerializedPayload(events[0]));
+
+    // already compressed events are not considered again
+    buffer.removeOld(170);
+    EXPECT_EQ(boost::uint64_t(7 * 1000), buffer.getUncompressedBytes());
+
+}
@@ -0,0 +1,95 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <rsb/MetaData.h>
+
+#include <rsb/tools/timesync/StaticTimestampSelectors.h>
+
+#include "rsb/tools/simplebuffer/RingBuffer.h"
+#include "rsb/tools/simplebuffer/TimeIndexedBuffer.h"
+
+#include "testhelpers.h"
+
+using namespace std;
+using namespace testing;
+using namespace rsb;
+using namespace rsb::tools::simplebuffer;
+using namespace rsb::tools::timesync;
+
+TEST(TimeIndexedBufferTest, testNearestByUserTime) {
+
+    TimeIndexedBuffer buffer(BufferPtr(new RingBuffer(1000)),
+            TimestampSelectorPtr(new UserTimestampSelector("capture")), 1000);
+
+    rsc::misc::UUID participant;
+    const boost::uint64_t captureTimes[] = { 500, 100, 300, 900 };
+    for (boost::uint32_t i = 0; i < 4; ++i) {
+        EventPtr event = createEvent(Scope(i % 2 ? "/a/b" : "/a"),
+                participant, i, i + 1);
+        event->mutableMetaData().setUserTime("capture", captureTimes[i]);
+        buffer.insert(event);
+    }
+    // stored but not indexed
+    buffer.insert(createEvent(Scope("/a"), participant, 4, 5));
+    EXPECT_EQ(size_t(5), buffer.size());
+
+    EXPECT_EQ(EventId(participant, 2),
+            buffer.getNearest(Scope("/a"), 290)->getId());
+    EXPECT_EQ(EventId(participant, 1),
+            buffer.getNearest(Scope("/a"), 0)->getId());
+    EXPECT_EQ(EventId(participant, 3),
+            buffer.getNearest(Scope("/"), 10000)->getId());
+    EXPECT_EQ(EventId(participant, 3),
+            buffer.getNearest(Scope("/a/b"), 600)->getId());
+    EXPECT_EQ(EventId(participant, 0),
+            buffer.getNearest(Scope("/a"), 600)->getId());
+    EXPECT_FALSE(buffer.getNearest(Scope("/c"), 600));
+
+}
+
+TEST(TimeIndexedBufferTest, testSkipsRemovedEvents) {
+
+    BufferPtr ring(new RingBuffer(100));
+    TimeIndexedBuffer buffer(ring,
+            TimestampSelectorPtr(new DeliverTimestampSelector), 1000);
+
+    rsc::misc::UUID participant;
+    buffer.insert(createEvent(Scope("/a"), participant, 0, 10));
+    buffer.insert(createEvent(Scope("/a"), participant, 1, 200));
+
+    // the decorated buffer drops the first event earlier than the index
+    ring->removeOld(150);
+    EXPECT_EQ(EventId(participant, 1),
+            buffer.getNearest(Scope("/a"), 0)->getId());
+
+    buffer.removeOld(1300);
+    EXPECT_FALSE(buffer.getNearest(Scope("/a"), 0));
+    EXPECT_EQ(size_t(0), buffer.size());
+
+}
@@ -0,0 +1,70 @@
+/* ============================================================
+ *
+ * This file is a part of the rsb-buffer project.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <string>
+
+#include <rsb/Event.h>
+#include <rsb/MetaData.h>
+#include <rsb/Scope.h>
+
+#include <rsc/misc/UUID.h>
+#include <rsc/runtime/TypeStringTools.h>
+
+#include "rsb/tools/simplebuffer/SerializedPayload.h"
+
+inline rsb::EventPtr createEvent(const rsb::Scope &scope,
+        const rsc::misc::UUID &participant,
+        const boost::uint32_t &sequenceNumber,
+        const boost::uint64_t &deliverTime) {
+    rsb::EventPtr event(new rsb::Event);
+    event->setId(participant, sequenceNumber);
+    event->setScope(scope);
+    event->mutableMetaData().setDeliverTime(deliverTime);
+    return event;
+}
+
+inline rsb::EventPtr createEvent(const rsc::misc::UUID &participant,
+        const boost::uint32_t &sequenceNumber,
+        const boost::uint64_t &deliverTime) {
+    return createEvent(rsb::Scope("/test"), participant, sequenceNumber,
+            deliverTime);
+}
+
+inline rsb::EventPtr createSerializedEvent(const rsc::misc::UUID &participant,
+        const boost::uint32_t &sequenceNumber,
+        const boost::uint64_t &deliverTime, const std::string &bytes) {
+    rsb::EventPtr event = createEvent(participant, sequenceNumber,
+            deliverTime);
+    event->setType(
+            rsc::runtime::typeName<rsb::tools::simplebuffer::SerializedPayload>());
+    event->setData(
+            rsb::tools::simplebuffer::SerializedPayloadPtr(
+                    new rsb::tools::simplebuffer::SerializedPayload("schema",
+                            bytes)));
+    return event;
+}